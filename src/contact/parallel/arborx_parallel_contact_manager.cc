@@ -251,7 +251,7 @@ ArborXParallelContactManager::ArborXParallelContactManager(
 }
 
 void
-ArborXParallelContactManager::ComputeParallelContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force)
+ArborXParallelContactManager::ComputeParallelContactForce(nimble::Viewify<2> contact_force)
 {
   if (model_data == nullptr) {
     auto model_ptr = this->data_manager_.GetModelData().get();
@@ -262,8 +262,10 @@ ArborXParallelContactManager::ComputeParallelContactForce(int step, bool debug_o
   auto displacement_d = model_data->GetDeviceVectorNodeData(field_ids.displacement);
 
   auto contact_force_h = model_data->GetHostVectorNodeData(field_ids.contact_force);
+  NIMBLE_ASSERT(
+      contact_force.data() == contact_force_h.data(),
+      "\nError in ComputeContactForce(), contact_force is not the host field.\n");
   auto contact_force_d = model_data->GetDeviceVectorNodeData(field_ids.contact_force);
-  Kokkos::deep_copy(contact_force_d, (double)(0.0));
 
   this->ApplyDisplacements(displacement_d);
 
@@ -324,13 +326,8 @@ ArborXParallelContactManager::ComputeParallelContactForce(int step, bool debug_o
   }
   this->stopTimer("Contact::EnforceInteraction");
 
-  this->GetForces(contact_force_d);
+  this->AddForces(contact_force_d);
   Kokkos::deep_copy(contact_force_h, contact_force_d);
-
-  // Perform a reduction to obtain correct values on MPI boundaries
-  constexpr int vector_dim           = 3;
-  auto          myVectorCommunicator = this->data_manager_.GetVectorCommunicator();
-  myVectorCommunicator->VectorReduction(vector_dim, contact_force_h);
 }
 
 }  // namespace nimble
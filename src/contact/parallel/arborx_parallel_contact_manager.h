@@ -70,7 +70,7 @@ class ArborXParallelContactManager : public ParallelContactManager
   ~ArborXParallelContactManager() override = default;
 
   void
-  ComputeParallelContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force) override;
+  ComputeParallelContactForce(nimble::Viewify<2> contact_force) override;
 
  protected:
   nimble_kokkos::ModelData* model_data = nullptr;
@@ -236,7 +236,7 @@ BvhContactManager::ComputeBoundingVolumes()
 }
 
 void
-BvhContactManager::ComputeParallelContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force)
+BvhContactManager::ComputeParallelContactForce(nimble::Viewify<2> contact_force)
 {
   auto model_ptr = this->data_manager_.GetModelData();
 
@@ -291,11 +291,7 @@ BvhContactManager::ComputeParallelContactForce(int step, bool debug_output, nimb
   total_num_contacts += m_last_results.size();
   total_enforcement_time.Stop();
 
-  this->GetForces(contact_force.data());
-
-  constexpr int vector_dim           = 3;
-  auto          myVectorCommunicator = this->data_manager_.GetVectorCommunicator();
-  myVectorCommunicator->VectorReduction(vector_dim, contact_force.data());
+  this->AddForces(contact_force.data());
 }
 
 namespace {
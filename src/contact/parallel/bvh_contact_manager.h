@@ -84,7 +84,7 @@ class BvhContactManager : public ParallelContactManager
   ~BvhContactManager() = default;
 
   void
-  ComputeParallelContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force) override;
+  ComputeParallelContactForce(nimble::Viewify<2> contact_force) override;
 
  private:
   void
@@ -59,13 +59,20 @@ class ParallelContactManager : public ContactManager
   ParallelContactManager(std::shared_ptr<ContactInterface> interface, nimble::DataManager& data_manager);
 
   void
-  ComputeContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force) override
+  ComputeLocalContactForce(nimble::Viewify<2> contact_force) override
   {
-    ComputeParallelContactForce(step, debug_output, contact_force);
+    ComputeParallelContactForce(contact_force);
   }
 
+  bool
+  HasLocalContactForce() const override
+  {
+    return false;
+  }
+
+  /// \brief Add the contact force of this rank to contact_force, see ComputeLocalContactForce
   virtual void
-  ComputeParallelContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force) = 0;
+  ComputeParallelContactForce(nimble::Viewify<2> contact_force) = 0;
 
   int
   Rank() const noexcept
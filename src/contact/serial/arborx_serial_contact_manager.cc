@@ -145,7 +145,7 @@ struct ArborXCallback
 };
 
 void
-ArborXSerialContactManager::ComputeSerialContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force)
+ArborXSerialContactManager::ComputeSerialContactForce(nimble::Viewify<2> contact_force)
 {
   //--- Constraint per ContactManager::ComputeContactForce
   NIMBLE_ASSERT(penalty_parameter_ > 0.0, "\nError in ComputeContactForce(), invalid penalty_parameter.\n");
@@ -159,8 +159,10 @@ ArborXSerialContactManager::ComputeSerialContactForce(int step, bool debug_outpu
   auto displacement_d = model_data->GetDeviceVectorNodeData(field_ids.displacement);
 
   auto contact_force_h = model_data->GetHostVectorNodeData(field_ids.contact_force);
+  NIMBLE_ASSERT(
+      contact_force.data() == contact_force_h.data(),
+      "\nError in ComputeContactForce(), contact_force is not the host field.\n");
   auto contact_force_d = model_data->GetDeviceVectorNodeData(field_ids.contact_force);
-  Kokkos::deep_copy(contact_force_d, (double)(0.0));
 
   this->ApplyDisplacements(displacement_d);
 
@@ -191,7 +193,7 @@ ArborXSerialContactManager::ComputeSerialContactForce(int step, bool debug_outpu
   this->stopTimer("ArborX::Search");
   this->stopTimer("Contact::EnforceInteraction");
 
-  this->GetForces(contact_force_d);
+  this->AddForces(contact_force_d);
   Kokkos::deep_copy(contact_force_h, contact_force_d);
 }
 
@@ -69,7 +69,7 @@ class ArborXSerialContactManager : public SerialContactManager
   ~ArborXSerialContactManager() override = default;
 
   void
-  ComputeSerialContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force) override;
+  ComputeSerialContactForce(nimble::Viewify<2> contact_force) override;
 
  private:
   template <typename ContactManagerType>
@@ -53,13 +53,14 @@ class SerialContactManager : public ContactManager
   SerialContactManager(std::shared_ptr<ContactInterface> interface, nimble::DataManager& data_manager);
 
   void
-  ComputeContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force) override
+  ComputeLocalContactForce(nimble::Viewify<2> contact_force) override
   {
-    ComputeSerialContactForce(step, debug_output, contact_force);
+    ComputeSerialContactForce(contact_force);
   }
 
+  /// \brief Add the contact force of this rank to contact_force, see ComputeLocalContactForce
   virtual void
-  ComputeSerialContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force) = 0;
+  ComputeSerialContactForce(nimble::Viewify<2> contact_force) = 0;
 
  private:
 };
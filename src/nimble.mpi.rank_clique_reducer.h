@@ -57,6 +57,115 @@
 #include "nimble.quanta.arrayview.h"
 
 namespace nimble {
+
+#if MPI_VERSION >= 3
+/// \brief Returns true when every rank of comm belongs to node_comm
+inline bool
+CommIsNodeLocal(MPI_Comm comm, MPI_Comm node_comm)
+{
+  MPI_Group group, node_group;
+  MPI_Comm_group(comm, &group);
+  MPI_Comm_group(node_comm, &node_group);
+  int size;
+  MPI_Group_size(group, &size);
+  std::vector<int> ranks(size), node_ranks(size);
+  for (int i = 0; i < size; ++i) ranks[i] = i;
+  MPI_Group_translate_ranks(group, size, ranks.data(), node_group, node_ranks.data());
+  MPI_Group_free(&group);
+  MPI_Group_free(&node_group);
+  return std::none_of(node_ranks.begin(), node_ranks.end(), [](int r) { return r == MPI_UNDEFINED; });
+}
+
+/// \brief Reduction buffers of a clique whose ranks all share a physical node
+///
+/// Every rank owns two slots (one per phase) in an MPI-3 shared-memory window.
+/// A reduction packs into the slot of the current phase, waits on a barrier
+/// and sums the slots of all ranks in rank order, so every rank gets the same
+/// result. Alternating phases means a single barrier per reduction: a rank
+/// can only write a slot again after every rank entered the next barrier,
+/// i.e. finished reading it.
+class SharedCliqueWindow
+{
+ public:
+  SharedCliqueWindow(MPI_Comm clique_comm, int buffersize) : buffersize_(buffersize)
+  {
+    MPI_Comm_rank(clique_comm, &rank_);
+    MPI_Comm_size(clique_comm, &size_);
+    double* base = nullptr;
+    MPI_Win_allocate_shared(
+        2 * static_cast<MPI_Aint>(buffersize_) * sizeof(double),
+        sizeof(double),
+        MPI_INFO_NULL,
+        clique_comm,
+        &base,
+        &window_);
+    slots_.resize(size_);
+    for (int r = 0; r < size_; ++r) {
+      MPI_Aint seg_size;
+      int      disp_unit;
+      MPI_Win_shared_query(window_, r, &seg_size, &disp_unit, &slots_[r]);
+    }
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, window_);
+  }
+
+  SharedCliqueWindow(const SharedCliqueWindow&) = delete;
+  SharedCliqueWindow&
+  operator=(const SharedCliqueWindow&) = delete;
+
+  ~SharedCliqueWindow()
+  {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (finalized) return;
+    MPI_Win_unlock_all(window_);
+    MPI_Win_free(&window_);
+  }
+
+  /// \brief Slot of this rank for the current phase
+  double*
+  OwnSlot()
+  {
+    return Slot(rank_);
+  }
+
+  /// \brief Make the packed slot visible to the other ranks
+  void
+  Publish()
+  {
+    MPI_Win_sync(window_);
+  }
+
+  /// \brief Sum the slots of all ranks into dest and switch phase
+  ///
+  /// \note Only valid once every rank has published, i.e. after the barrier
+  void
+  Sum(double* dest, int count)
+  {
+    MPI_Win_sync(window_);
+    std::copy_n(Slot(0), count, dest);
+    for (int r = 1; r < size_; ++r) {
+      const double* src = Slot(r);
+      for (int i = 0; i < count; ++i) dest[i] += src[i];
+    }
+    phase_ = 1 - phase_;
+  }
+
+ private:
+  double*
+  Slot(int rank)
+  {
+    return slots_[rank] + phase_ * buffersize_;
+  }
+
+  MPI_Win              window_ = MPI_WIN_NULL;
+  std::vector<double*> slots_;
+  int                  buffersize_;
+  int                  rank_  = 0;
+  int                  size_  = 1;
+  int                  phase_ = 0;
+};
+#endif
+
 struct ReductionClique_t
 {
   std::unique_ptr<int[]>    indices;
@@ -67,6 +176,10 @@ struct ReductionClique_t
   MPI_Comm                  clique_comm;
   MPI_Request               Iallreduce_request;
   bool                      exists_active_asyncreduce_request = false;
+#if MPI_VERSION >= 3
+  /// \brief Shared-memory buffers, only set when all ranks of the clique are on one node
+  std::unique_ptr<SharedCliqueWindow> shared_window;
+#endif
 
   ReductionClique_t() {}
   /* README
@@ -109,6 +222,34 @@ struct ReductionClique_t
   ReductionClique_t(ReductionClique_t&& source) = default;
   ReductionClique_t&
   operator=(ReductionClique_t&& source) = default;
+  /// \brief Reduce through shared memory instead of messaging
+  ///
+  /// \note Collective over clique_comm, whose ranks must all share a node
+  void
+  EnableSharedMemoryReduction()
+  {
+#if MPI_VERSION >= 3
+    shared_window.reset(new SharedCliqueWindow(clique_comm, buffersize));
+#endif
+  }
+  bool
+  UsesSharedMemoryReduction() const
+  {
+#if MPI_VERSION >= 3
+    return static_cast<bool>(shared_window);
+#else
+    return false;
+#endif
+  }
+  /// \brief Buffer receiving the packed contributions of this rank
+  double*
+  packbuffer()
+  {
+#if MPI_VERSION >= 3
+    if (shared_window) return shared_window->OwnSlot();
+#endif
+    return sendbuffer.get();
+  }
   bool
   okayfieldsizeQ(int field_size)
   {
@@ -122,6 +263,9 @@ struct ReductionClique_t
   void
   resizebuffer(int newbuffersize)
   {
+    if (UsesSharedMemoryReduction()) {
+      throw std::invalid_argument("Shared-memory reduction buffers can not be resized");
+    }
     sendbuffer.reset(new double[newbuffersize]);
     recvbuffer.reset(new double[newbuffersize]);
     buffersize = newbuffersize;
@@ -131,7 +275,7 @@ struct ReductionClique_t
   void
   pack(double* source)
   {
-    double* destscan  = sendbuffer.get();
+    double* destscan  = packbuffer();
     int *   index_ptr = indices.get(), *index_ptr_end = index_ptr + n_indices;
     for (; index_ptr < index_ptr_end; ++index_ptr) {
       double* sourcescan = source + (*index_ptr) * field_size;
@@ -161,7 +305,7 @@ struct ReductionClique_t
   void
   pack(Lookup& source)
   {
-    double* destscan = sendbuffer.get();
+    double* destscan = packbuffer();
 
     for (int index : quanta::arrayview_t<int>(indices.get(), n_indices)) {
       for (int j = 0; j < field_size; ++j) { *destscan++ = source(index, j); }
@@ -188,6 +332,15 @@ struct ReductionClique_t
   {
     EnsureDataSafety(field_size);
     pack<field_size>(data);
+#if MPI_VERSION >= 3
+    if (shared_window) {
+      shared_window->Publish();
+      MPI_Barrier(clique_comm);
+      shared_window->Sum(recvbuffer.get(), n_indices * field_size);
+      unpack<field_size>(data);
+      return;
+    }
+#endif
     MPI_Allreduce(sendbuffer.get(), recvbuffer.get(), n_indices * field_size, MPI_DOUBLE, MPI_SUM, clique_comm);
     unpack<field_size>(data);
   }
@@ -206,6 +359,15 @@ struct ReductionClique_t
 
     EnsureDataSafety(field_size);
     pack<field_size>(databuffer);
+#if MPI_VERSION >= 3
+    if (shared_window) {
+      // on-node cliques only need to know that every rank has packed its slot
+      shared_window->Publish();
+      MPI_Ibarrier(clique_comm, &Iallreduce_request);
+      exists_active_asyncreduce_request = true;
+      return;
+    }
+#endif
     MPI_Iallreduce(
         sendbuffer.get(),
         recvbuffer.get(),
@@ -244,6 +406,9 @@ struct ReductionClique_t
   {
     if (exists_active_asyncreduce_request) {
       if (Iallreduce_completedQ()) {
+#if MPI_VERSION >= 3
+        if (shared_window) shared_window->Sum(recvbuffer.get(), n_indices * field_size);
+#endif
         unpack<field_size>(databuffer);
         exists_active_asyncreduce_request = false;
         return true;
@@ -118,34 +118,66 @@ struct ReductionInfo
       std::sort(index_list.begin(), index_list.end(), [&](int a, int b) { return global_ids[a] < global_ids[b]; });
       this->cliques.emplace_back(std::move(index_list), index_list.size() * 3, comm);
     }
+
+#if MPI_VERSION >= 3
+    // Cliques whose ranks all sit on the same physical node reduce through
+    // shared memory; only cliques spanning several nodes go through messaging
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(context.get_comm(), MPI_COMM_TYPE_SHARED, context.get_rank(), MPI_INFO_NULL, &node_comm);
+    for (auto& clique : cliques) {
+      if (CommIsNodeLocal(clique.clique_comm, node_comm)) clique.EnableSharedMemoryReduction();
+    }
+    MPI_Comm_free(&node_comm);
+#endif
   }
 
   ReductionInfo() {}
   ReductionInfo(ReductionInfo&& ri) = default;
   ReductionInfo&
   operator=(ReductionInfo&& ri) = default;
+  // Starts the asynchronous reduction of every clique
   template <int field_size, class Lookup>
   void
-  Reduce(Lookup&& data)
+  StartReduce(Lookup&& data)
   {
     for (auto& clique : cliques) clique.asyncreduce_initialize<field_size>(data);
 
     unfinished.resize(cliques.size());
     std::iota(unfinished.begin(), unfinished.end(), 0);
+  }
+  // Unpacks the cliques whose reduction completed, returns true once all did
+  template <int field_size, class Lookup>
+  bool
+  ProgressReduce(Lookup&& data)
+  {
+    int increment = 0;
+    for (size_t i = 0; i < unfinished.size(); i += increment) {
+      bool reduceFinished = cliques[unfinished[i]].asyncreduce_finalize<field_size>(data);
 
-    while (!unfinished.empty()) {
-      int increment = 0;
-      for (size_t i = 0; i < unfinished.size(); i += increment) {
-        bool reduceFinished = cliques[unfinished[i]].asyncreduce_finalize<field_size>(data);
-
-        increment = !reduceFinished;
+      increment = !reduceFinished;
 
-        if (reduceFinished) {
-          unfinished[i] = unfinished.back();
-          unfinished.pop_back();
-        }
+      if (reduceFinished) {
+        unfinished[i] = unfinished.back();
+        unfinished.pop_back();
       }
     }
+    return unfinished.empty();
+  }
+  template <int field_size, class Lookup>
+  void
+  Reduce(Lookup&& data)
+  {
+    StartReduce<field_size>(data);
+    while (!ProgressReduce<field_size>(data)) {}
+  }
+  // Local indices of all the nodes shared with other ranks (no communication)
+  void
+  GetSharedIndices(std::vector<int>& indices)
+  {
+    for (auto& clique : cliques) {
+      int const* clique_indices = clique.GetIndices();
+      indices.insert(indices.end(), clique_indices, clique_indices + clique.GetNumIndices());
+    }
   }
   void
   GetAllIndices(std::vector<int>& indices, std::vector<int>& min_rank_containing_index)
@@ -173,6 +205,26 @@ struct ReductionInfo
         throw std::invalid_argument("Bad field size of " + fs);
     }
   }
+  void
+  StartReduction(double* data, int field_size)
+  {
+    switch (field_size) {
+      case 1: StartReduce<1>(data); break;
+      case 2: StartReduce<2>(data); break;
+      case 3: StartReduce<3>(data); break;
+      default: throw std::invalid_argument("Bad field size of " + std::to_string(field_size));
+    }
+  }
+  bool
+  ProgressReduction(double* data, int field_size)
+  {
+    switch (field_size) {
+      case 1: return ProgressReduce<1>(data);
+      case 2: return ProgressReduce<2>(data);
+      case 3: return ProgressReduce<3>(data);
+      default: throw std::invalid_argument("Bad field size of " + std::to_string(field_size));
+    }
+  }
   template <class Lookup>
   void
   PerformReduction(Lookup& lookup, int field_size)
@@ -47,8 +47,14 @@
 #include <nimble_macros.h>
 #include <nimble_material.h>
 #include <nimble_material_factory.h>
+#include <nimble_utils.h>
+
+#ifdef NIMBLE_HAVE_KOKKOS
+#include "nimble_kokkos_defs.h"
+#endif
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <utility>
 #include <vector>
@@ -56,9 +62,15 @@
 namespace nimble {
 
 void
-Block::Initialize(std::string const& model_material_parameters, MaterialFactory& factory)
+Block::Initialize(
+    std::string const& model_material_parameters,
+    std::string const& element_type,
+    std::string const& element_formulation,
+    MaterialFactory&   factory)
 {
   model_material_parameters_ = model_material_parameters;
+  element_type_              = element_type;
+  element_formulation_       = element_formulation;
   InstantiateMaterialModel(factory);
   InstantiateElement();
 }
@@ -78,7 +90,24 @@ Block::InstantiateMaterialModel(MaterialFactory& factory)
 void
 Block::InstantiateElement()
 {
-  element_ = std::make_shared<HexElement>();
+  if ((element_formulation_ == "composite" && element_type_ != "TETRA10") ||
+      (element_formulation_ == "nodal_averaged" && element_type_ != "TETRA")) {
+    NIMBLE_ABORT(
+        "\nError in Block::InstantiateElement(), formulation " + element_formulation_ +
+        " is not available for element type " + element_type_ + "\n");
+  }
+
+  if (element_type_ == "HEX") {
+    element_ = std::make_shared<HexElement>();
+  } else if (element_type_ == "TETRA") {
+    element_ = std::make_shared<TetElement>();
+  } else if (element_type_ == "TETRA10" && element_formulation_ == "composite") {
+    element_ = std::make_shared<CompositeTet10Element>();
+  } else if (element_type_ == "TETRA10") {
+    element_ = std::make_shared<Tet10Element>();
+  } else {
+    NIMBLE_ABORT("\nError in Block::InstantiateElement(), unsupported element type " + element_type_ + "\n");
+  }
 }
 
 void
@@ -151,8 +180,8 @@ Block::InitializeElementData(
     std::vector<int> const&         elem_global_ids_in_block,
     std::vector<std::string> const& elem_data_labels,
     std::vector<std::string> const& derived_elem_data_labels,
-    std::vector<double>&            elem_data_n,
-    std::vector<double>&            elem_data_np1,
+    std::vector<StateScalar>&       elem_data_n,
+    std::vector<StateScalar>&       elem_data_np1,
     MaterialFactory&                material_factory,
     DataManager&                    data_manager)
 {
@@ -179,7 +208,7 @@ Block::InitializeElementData(
     std::string ipt_label = RemoveIntegrationPointPrefix(label);
 
     double initial_value = 0.0;
-    auto   it            = state_variable_initial_values.find(label);
+    auto   it            = state_variable_initial_values.find(ipt_label);
     if (it != state_variable_initial_values.end()) { initial_value = it->second; }
 
     for (int i_elem = 0; i_elem < num_elem_in_block; ++i_elem) {
@@ -206,6 +235,54 @@ Block::InitializeElementData(
   DetermineDataOffsets(elem_data_labels, derived_elem_data_labels);
 }
 
+namespace {
+
+/// \brief Scale a deformation gradient so that its determinant is j_bar
+///
+/// \param j_bar Volume ratio averaged over the nodes of the element
+/// \param def_grad Deformation gradient, component i at def_grad[i * stride]
+/// \param stride Distance between consecutive components
+inline void
+ApplyNodalAveragedJacobian(double j_bar, double* def_grad, int stride)
+{
+  double f[9];
+  for (int i = 0; i < 9; i++) { f[i] = def_grad[i * stride]; }
+  double scale = std::cbrt(j_bar / Determinant_Full33(f));
+  for (int i = 0; i < 9; i++) { def_grad[i * stride] = scale * f[i]; }
+}
+
+/// \brief Size the scratch arrays for tiles of at most max_tile_nodes nodes
+///
+/// Resizing to the same sizes keeps the storage, so the arrays are allocated
+/// once and reused over the time steps.
+void
+ResizeTileWorkspace(ElementTileWorkspace& ws, Element& element, Material& material, int max_tile_nodes)
+{
+  int width          = NIMBLE_ELEMENT_BATCH_WIDTH;
+  int dim            = element.Dim();
+  int vector_size    = LengthToInt(VECTOR, dim);
+  int num_node_data  = vector_size * element.NumNodesPerElement();
+  int num_int_pt     = element.NumIntegrationPointsPerElement();
+  int num_def_grad   = LengthToInt(FULL_TENSOR, dim) * num_int_pt;
+  int num_stress     = LengthToInt(SYMMETRIC_TENSOR, dim) * num_int_pt;
+  int num_state_data = material.NumStateVariables() * num_int_pt;
+  ws.tile_reference_coordinates.resize(vector_size * max_tile_nodes);
+  ws.tile_displacement.resize(vector_size * max_tile_nodes);
+  ws.tile_force.resize(vector_size * max_tile_nodes);
+  ws.tile_jacobian.resize(max_tile_nodes);
+  ws.ref_coord.resize(num_node_data * width);
+  ws.cur_coord.resize(num_node_data * width);
+  ws.force.resize(num_node_data * width);
+  ws.def_grad_n.resize(num_def_grad * width);
+  ws.def_grad_np1.resize(num_def_grad * width);
+  ws.stress_n.resize(num_stress * width);
+  ws.stress_np1.resize(num_stress * width);
+  ws.state_data_n.resize(num_state_data * width);
+  ws.state_data_np1.resize(num_state_data * width);
+}
+
+}  // namespace
+
 struct ComputeInternalForceFunctor
 {
   std::shared_ptr<Element>  element_;
@@ -215,21 +292,29 @@ struct ComputeInternalForceFunctor
   const std::vector<int>& stress_offset_;
   const std::vector<int>& state_data_offset_;
 
-  const double* reference_coordinates;
-  const double* displacement;
-  const double* velocity;
-  double*       internal_force;
-  double        time_previous;
-  double        time_current;
-  int           num_elem;
-  const int*    elem_conn;
-  const int*    elem_global_ids;
-  int           num_element_data;
-  const double* elem_data_n;
-  double*       elem_data_np1;
-  DataManager&  data_manager;
-  bool          is_output_step;
-  bool          compute_stress_only;
+  const double*      reference_coordinates;
+  const double*      displacement;
+  const double*      velocity;
+  double*            internal_force;
+  double             time_previous;
+  double             time_current;
+  int                num_elem;
+  const int*         elem_conn;
+  const int*         elem_global_ids;
+  int                num_element_data;
+  const StateScalar* elem_data_n;
+  StateScalar*       elem_data_np1;
+  DataManager&       data_manager;
+  bool               is_output_step;
+  bool               compute_stress_only;
+  ElementActivity*   activity;
+  const double*      nodal_jacobian;
+
+  const ElementTiling&  tiling;
+  ElementTileWorkspace* workspaces;
+#ifdef NIMBLE_HAVE_KOKKOS
+  Kokkos::Experimental::UniqueToken<Kokkos::DefaultHostExecutionSpace> thread_token;
+#endif
 
   ComputeInternalForceFunctor(
       std::shared_ptr<Element>  element,
@@ -247,11 +332,15 @@ struct ComputeInternalForceFunctor
       const int*                elem_conn_,
       const int*                elem_global_ids_,
       int                       num_element_data_,
-      const double*             elem_data_n_,
-      double*                   elem_data_np1_,
+      const StateScalar*        elem_data_n_,
+      StateScalar*              elem_data_np1_,
       DataManager&              data_manager_,
       bool                      is_output_step_,
-      bool                      compute_stress_only_)
+      bool                      compute_stress_only_,
+      ElementActivity*          activity_,
+      const double*             nodal_jacobian_,
+      const ElementTiling&      tiling_,
+      ElementTileWorkspace*     workspaces_)
       : element_(element),
         material_(material),
         def_grad_offset_(def_grad_offset),
@@ -271,12 +360,211 @@ struct ComputeInternalForceFunctor
         elem_data_np1(elem_data_np1_),
         data_manager(data_manager_),
         is_output_step(is_output_step_),
-        compute_stress_only(compute_stress_only_)
+        compute_stress_only(compute_stress_only_),
+        activity(activity_),
+        nodal_jacobian(nodal_jacobian_),
+        tiling(tiling_),
+        workspaces(workspaces_)
   {
   }
 
+  /// \brief Process one tile against compact copies of its node data
   void
-  operator()(int elem) const
+  operator()(int tile) const
+  {
+#ifdef NIMBLE_HAVE_KOKKOS
+    int thread_id = thread_token.acquire();
+#else
+    int thread_id = 0;
+#endif
+    ElementTileWorkspace& ws = workspaces[thread_id];
+
+    int vector_size       = LengthToInt(VECTOR, element_->Dim());
+    int num_node_per_elem = element_->NumNodesPerElement();
+
+    const int  first_node     = tiling.tile_first_node[tile];
+    const int  num_tile_nodes = tiling.tile_first_node[tile + 1] - first_node;
+    const int* tile_node_ids  = &tiling.tile_node_ids[first_node];
+    const int* tile_elems     = &tiling.tile_elems[tiling.tile_first_elem[tile]];
+    const int  num_tile_elems = tiling.tile_first_elem[tile + 1] - tiling.tile_first_elem[tile];
+
+    double* tile_reference_coordinates = ws.tile_reference_coordinates.data();
+    double* tile_displacement          = ws.tile_displacement.data();
+    double* tile_force                 = ws.tile_force.data();
+    for (int node = 0; node < num_tile_nodes; node++) {
+      int node_id = tile_node_ids[node];
+      for (int i = 0; i < vector_size; i++) {
+        tile_reference_coordinates[node * vector_size + i] = reference_coordinates[vector_size * node_id + i];
+        tile_displacement[node * vector_size + i]          = displacement[vector_size * node_id + i];
+      }
+      if (nodal_jacobian != nullptr) { ws.tile_jacobian[node] = nodal_jacobian[node_id]; }
+    }
+    if (!compute_stress_only) { std::fill(tile_force, tile_force + vector_size * num_tile_nodes, 0.0); }
+    const double* node_jacobian = (nodal_jacobian == nullptr) ? nullptr : ws.tile_jacobian.data();
+
+    if (activity == nullptr) {
+      // Batches of NIMBLE_ELEMENT_BATCH_WIDTH elements, the last one is partially filled
+      for (int k = 0; k < num_tile_elems; k += NIMBLE_ELEMENT_BATCH_WIDTH) {
+        int num_lanes = std::min(NIMBLE_ELEMENT_BATCH_WIDTH, num_tile_elems - k);
+        ComputeElementBatch(
+            &tile_elems[k], num_lanes, tile_reference_coordinates, tile_displacement, node_jacobian, tile_force, ws);
+      }
+    } else {
+      // Sleeping elements are handled one at a time
+      for (int k = 0; k < num_tile_elems; k++) {
+        int elem = tile_elems[k];
+        ComputeElement(
+            elem,
+            &tiling.local_elem_conn[elem * num_node_per_elem],
+            tile_reference_coordinates,
+            tile_displacement,
+            node_jacobian,
+            tile_force);
+      }
+    }
+
+    if (!compute_stress_only) {
+      // One scatter per tile, only the nodes shared with other tiles can conflict
+      for (int node = 0; node < num_tile_nodes; node++) {
+        int node_id = tile_node_ids[node];
+        for (int i = 0; i < vector_size; i++) {
+#ifdef NIMBLE_HAVE_KOKKOS
+          Kokkos::atomic_add(&internal_force[vector_size * node_id + i], tile_force[node * vector_size + i]);
+#else
+          internal_force[vector_size * node_id + i] += tile_force[node * vector_size + i];
+#endif
+        }
+      }
+    }
+
+#ifdef NIMBLE_HAVE_KOKKOS
+    thread_token.release(thread_id);
+#endif
+  }
+
+  /// \brief Compute the stress and add the nodal forces of a batch of elements
+  ///
+  /// Same as ComputeElement for elements elems[0] to elems[num_lanes - 1],
+  /// with one SIMD lane per element in the element and material kernels.
+  void
+  ComputeElementBatch(
+      const int*            elems,
+      int                   num_lanes,
+      const double*         node_reference_coordinates,
+      const double*         node_displacement,
+      const double*         node_jacobian,
+      double*               node_force,
+      ElementTileWorkspace& ws) const
+  {
+    constexpr int width               = NIMBLE_ELEMENT_BATCH_WIDTH;
+    int           dim                 = element_->Dim();
+    int           num_node_per_elem   = element_->NumNodesPerElement();
+    int           num_int_pt_per_elem = element_->NumIntegrationPointsPerElement();
+    int           vector_size         = LengthToInt(VECTOR, dim);
+    int           full_tensor_size    = LengthToInt(FULL_TENSOR, dim);
+    int           sym_tensor_size     = LengthToInt(SYMMETRIC_TENSOR, dim);
+    int           num_state_data      = material_->NumStateVariables();
+
+    // Gather, lane l holds element elems[l]
+    for (int lane = 0; lane < num_lanes; lane++) {
+      int                elem           = elems[lane];
+      const int*         conn           = &tiling.local_elem_conn[elem * num_node_per_elem];
+      const StateScalar* my_elem_data_n = &elem_data_n[elem * num_element_data];
+      ws.elem_ids[lane]                 = elem_global_ids[elem];
+      for (int node = 0; node < num_node_per_elem; node++) {
+        int node_id = conn[node];
+        for (int i = 0; i < vector_size; i++) {
+          int entry           = (node * vector_size + i) * width + lane;
+          ws.ref_coord[entry] = node_reference_coordinates[vector_size * node_id + i];
+          ws.cur_coord[entry] = ws.ref_coord[entry] + node_displacement[vector_size * node_id + i];
+        }
+      }
+      for (int i = 0; i < full_tensor_size * num_int_pt_per_elem; i++) {
+        ws.def_grad_n[i * width + lane] = my_elem_data_n[def_grad_offset_[i]];
+      }
+      for (int i = 0; i < sym_tensor_size * num_int_pt_per_elem; i++) {
+        ws.stress_n[i * width + lane] = my_elem_data_n[stress_offset_[i]];
+      }
+      for (int i = 0; i < num_state_data * num_int_pt_per_elem; i++) {
+        ws.state_data_n[i * width + lane] = my_elem_data_n[state_data_offset_[i]];
+      }
+    }
+
+    element_->ComputeDeformationGradientsBatch(num_lanes, ws.ref_coord.data(), ws.cur_coord.data(), ws.def_grad_np1.data());
+
+    if (node_jacobian != nullptr) {
+      for (int lane = 0; lane < num_lanes; lane++) {
+        const int* conn  = &tiling.local_elem_conn[elems[lane] * num_node_per_elem];
+        double     j_bar = 0.0;
+        for (int node = 0; node < num_node_per_elem; node++) { j_bar += node_jacobian[conn[node]]; }
+        j_bar /= num_node_per_elem;
+        for (int i_ipt = 0; i_ipt < num_int_pt_per_elem; i_ipt++) {
+          ApplyNodalAveragedJacobian(j_bar, &ws.def_grad_np1[i_ipt * full_tensor_size * width + lane], width);
+        }
+      }
+    }
+
+    material_->GetStressBatch(
+        num_lanes,
+        ws.elem_ids,
+        num_int_pt_per_elem,
+        time_previous,
+        time_current,
+        ws.def_grad_n.data(),
+        ws.def_grad_np1.data(),
+        ws.stress_n.data(),
+        ws.stress_np1.data(),
+        num_state_data > 0 ? ws.state_data_n.data() : nullptr,
+        num_state_data > 0 ? ws.state_data_np1.data() : nullptr,
+        data_manager,
+        is_output_step);
+
+    // Scatter to the global containers
+    for (int lane = 0; lane < num_lanes; lane++) {
+      StateScalar* my_elem_data_np1 = &elem_data_np1[elems[lane] * num_element_data];
+      for (int i = 0; i < full_tensor_size * num_int_pt_per_elem; i++) {
+        my_elem_data_np1[def_grad_offset_[i]] = ws.def_grad_np1[i * width + lane];
+      }
+      for (int i = 0; i < sym_tensor_size * num_int_pt_per_elem; i++) {
+        my_elem_data_np1[stress_offset_[i]] = ws.stress_np1[i * width + lane];
+      }
+      for (int i = 0; i < num_state_data * num_int_pt_per_elem; i++) {
+        my_elem_data_np1[state_data_offset_[i]] = ws.state_data_np1[i * width + lane];
+      }
+    }
+
+    if (compute_stress_only) { return; }
+
+    element_->ComputeNodalForcesBatch(num_lanes, ws.cur_coord.data(), ws.stress_np1.data(), ws.force.data());
+
+    // Accumulate the internal force in the tile buffer
+    for (int lane = 0; lane < num_lanes; lane++) {
+      const int* conn = &tiling.local_elem_conn[elems[lane] * num_node_per_elem];
+      for (int node = 0; node < num_node_per_elem; node++) {
+        int node_id = conn[node];
+        for (int i = 0; i < vector_size; i++) {
+          node_force[vector_size * node_id + i] += ws.force[(node * vector_size + i) * width + lane];
+        }
+      }
+    }
+  }
+
+  /// \brief Compute the stress and add the nodal forces of one element
+  ///
+  /// \param elem Element index in the block
+  /// \param conn Element connectivity in terms of the node arrays passed in
+  /// \param node_reference_coordinates Reference coordinates of the nodes in conn
+  /// \param node_displacement Displacement of the nodes in conn
+  /// \param node_jacobian Volume ratio of the nodes in conn, nullptr without nodal averaging
+  /// \param node_force Force accumulated for the nodes in conn
+  void
+  ComputeElement(
+      int           elem,
+      const int*    conn,
+      const double* node_reference_coordinates,
+      const double* node_displacement,
+      const double* node_jacobian,
+      double*       node_force) const
   {
     int dim                 = element_->Dim();
     int num_node_per_elem   = element_->NumNodesPerElement();
@@ -294,6 +582,24 @@ struct ComputeInternalForceFunctor
     double cauchy_stress_np1[sym_tensor_size * num_int_pt_per_elem];
     double force[vector_size * num_node_per_elem];
 
+    const StateScalar* my_elem_data_n   = &elem_data_n[elem * num_element_data];
+    StateScalar*       my_elem_data_np1 = &elem_data_np1[elem * num_element_data];
+
+    if (activity != nullptr && !activity->is_awake[elem]) {
+      // Sleeping element, keep the state at step n and reuse the last nodal force
+      for (int i = 0; i < num_element_data; i++) { my_elem_data_np1[i] = my_elem_data_n[i]; }
+      if (!compute_stress_only) {
+        const double* cached_force = &activity->nodal_force[elem * vector_size * num_node_per_elem];
+        for (int node = 0; node < num_node_per_elem; node++) {
+          int node_id = conn[node];
+          for (int i = 0; i < vector_size; i++) {
+            node_force[vector_size * node_id + i] += cached_force[node * vector_size + i];
+          }
+        }
+      }
+      return;
+    }
+
     double*             state_data_n   = nullptr;
     double*             state_data_np1 = nullptr;
     std::vector<double> state_data_n_vec;
@@ -307,18 +613,24 @@ struct ComputeInternalForceFunctor
     }
 
     for (int node = 0; node < num_node_per_elem; node++) {
-      int node_id = elem_conn[elem * num_node_per_elem + node];
+      int node_id = conn[node];
       for (int i = 0; i < vector_size; i++) {
-        ref_coord[node * vector_size + i] = reference_coordinates[vector_size * node_id + i];
+        ref_coord[node * vector_size + i] = node_reference_coordinates[vector_size * node_id + i];
         cur_coord[node * vector_size + i] =
-            reference_coordinates[vector_size * node_id + i] + displacement[vector_size * node_id + i];
+            node_reference_coordinates[vector_size * node_id + i] + node_displacement[vector_size * node_id + i];
       }
     }
 
     element_->ComputeDeformationGradients(ref_coord, cur_coord, def_grad_np1);
 
-    const double* my_elem_data_n   = &elem_data_n[elem * num_element_data];
-    double*       my_elem_data_np1 = &elem_data_np1[elem * num_element_data];
+    if (node_jacobian != nullptr) {
+      double j_bar = 0.0;
+      for (int node = 0; node < num_node_per_elem; node++) { j_bar += node_jacobian[conn[node]]; }
+      j_bar /= num_node_per_elem;
+      for (int i_ipt = 0; i_ipt < num_int_pt_per_elem; i_ipt++) {
+        ApplyNodalAveragedJacobian(j_bar, &def_grad_np1[i_ipt * full_tensor_size], 1);
+      }
+    }
 
     // Copy data from the global data containers
     for (int i_ipt = 0; i_ipt < num_int_pt_per_elem; i_ipt++) {
@@ -367,19 +679,26 @@ struct ComputeInternalForceFunctor
       }
     }
 
+    if (activity != nullptr) {
+      double strain_increment = 0.0;
+      for (int i = 0; i < full_tensor_size * num_int_pt_per_elem; i++) {
+        strain_increment = std::max(strain_increment, std::abs(def_grad_np1[i] - def_grad_n[i]));
+      }
+      activity->strain_increment[elem] = strain_increment;
+    }
+
     if (!compute_stress_only) {
       element_->ComputeNodalForces(cur_coord, cauchy_stress_np1, force);
 
-      // Copy internal force to global containers
+      if (activity != nullptr) {
+        double* cached_force = &activity->nodal_force[elem * vector_size * num_node_per_elem];
+        for (int i = 0; i < vector_size * num_node_per_elem; i++) { cached_force[i] = force[i]; }
+      }
+
+      // Accumulate the internal force in the tile buffer
       for (int node = 0; node < num_node_per_elem; node++) {
-        int node_id = elem_conn[elem * num_node_per_elem + node];
-        for (int i = 0; i < vector_size; i++) {
-#ifdef NIMBLE_HAVE_KOKKOS
-          Kokkos::atomic_add(&internal_force[vector_size * node_id + i], force[node * vector_size + i]);
-#else
-          internal_force[vector_size * node_id + i] += force[node * vector_size + i];
-#endif
-        }
+        int node_id = conn[node];
+        for (int i = 0; i < vector_size; i++) { node_force[vector_size * node_id + i] += force[node * vector_size + i]; }
       }
     }
   }
@@ -397,14 +716,51 @@ Block::ComputeInternalForce(
     const int*                      elem_conn,
     const int*                      elem_global_ids,
     std::vector<std::string> const& elem_data_labels,
-    std::vector<double> const&      elem_data_n,
-    std::vector<double>&            elem_data_np1,
+    std::vector<StateScalar> const& elem_data_n,
+    std::vector<StateScalar>&       elem_data_np1,
     DataManager&                    data_manager,
     bool                            is_output_step,
-    bool                            compute_stress_only) const
+    bool                            compute_stress_only,
+    ElementActivity*                activity,
+    TileSubset                      tile_subset,
+    const std::vector<char>*        node_is_shared,
+    const double*                   nodal_jacobian) const
 {
-  double* elem_data_np1_ptr = elem_data_np1.data();
-  int     num_element_data  = static_cast<int>(elem_data_labels.size());
+  StateScalar* elem_data_np1_ptr = elem_data_np1.data();
+  int          num_element_data  = static_cast<int>(elem_data_labels.size());
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  int num_threads = Kokkos::Experimental::UniqueToken<Kokkos::DefaultHostExecutionSpace>().size();
+#else
+  int num_threads = 1;
+#endif
+
+  // A tile subset needs the tiles built apart for the elements touching the shared nodes
+  const bool split_tiles = (tile_subset != ALL_TILES);
+  if (split_tiles && node_is_shared == nullptr) {
+    NIMBLE_ABORT("\nError in Block::ComputeInternalForce(), a tile subset requires the shared nodes.\n");
+  }
+
+  if (!tiling_.Matches(num_elem, elem_conn) || (split_tiles && !tiling_.IsClassified())) {
+    int num_node_per_elem  = element_->NumNodesPerElement();
+    int vector_size        = LengthToInt(VECTOR, element_->Dim());
+    int bytes_per_node     = 3 * vector_size * static_cast<int>(sizeof(double));
+    int max_nodes_per_tile = std::max(num_node_per_elem, tile_cache_bytes_ / bytes_per_node);
+    tiling_.Build(
+        num_elem,
+        num_node_per_elem,
+        elem_conn,
+        max_nodes_per_tile,
+        tiles_per_thread_ * num_threads,
+        split_tiles ? node_is_shared : nullptr);
+
+    int max_tile_nodes = 0;
+    for (int tile = 0; tile < tiling_.NumTiles(); tile++) {
+      max_tile_nodes = std::max(max_tile_nodes, tiling_.tile_first_node[tile + 1] - tiling_.tile_first_node[tile]);
+    }
+    tile_workspaces_.resize(num_threads);
+    for (auto& ws : tile_workspaces_) { ResizeTileWorkspace(ws, *element_, *material_, max_tile_nodes); }
+  }
 
   ComputeInternalForceFunctor functor(
       element_,
@@ -426,13 +782,199 @@ Block::ComputeInternalForce(
       elem_data_np1_ptr,
       data_manager,
       is_output_step,
-      compute_stress_only);
+      compute_stress_only,
+      activity,
+      nodal_jacobian,
+      tiling_,
+      tile_workspaces_.data());
 
+  if (tile_subset == ALL_TILES) {
 #ifdef NIMBLE_HAVE_KOKKOS
-  Kokkos::parallel_for(num_elem, functor);
+    Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, tiling_.NumTiles()), functor);
 #else
-  for (int elem = 0; elem < num_elem; elem++) { functor(elem); }  // for (int elem = 0; elem < num_elem; elem++)
+    for (int tile = 0; tile < tiling_.NumTiles(); tile++) { functor(tile); }
 #endif
+    return;
+  }
+
+  const std::vector<int>& tiles     = (tile_subset == BOUNDARY_TILES) ? tiling_.boundary_tiles : tiling_.interior_tiles;
+  const int               num_tiles = static_cast<int>(tiles.size());
+#ifdef NIMBLE_HAVE_KOKKOS
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_tiles), [&](int i) { functor(tiles[i]); });
+#else
+  for (int i = 0; i < num_tiles; i++) { functor(tiles[i]); }
+#endif
+}
+
+void
+Block::ComputeNodalVolume(
+    const double* reference_coordinates,
+    const double* displacement,
+    int           num_elem,
+    const int*    elem_conn,
+    double*       nodal_volume) const
+{
+  int dim               = element_->Dim();
+  int num_node_per_elem = element_->NumNodesPerElement();
+  int vector_size       = LengthToInt(VECTOR, dim);
+
+  std::vector<double> coord(vector_size * num_node_per_elem);
+  for (int elem = 0; elem < num_elem; elem++) {
+    for (int node = 0; node < num_node_per_elem; node++) {
+      int node_id = elem_conn[elem * num_node_per_elem + node];
+      for (int i = 0; i < vector_size; i++) {
+        coord[node * vector_size + i] = reference_coordinates[vector_size * node_id + i];
+        if (displacement != nullptr) { coord[node * vector_size + i] += displacement[vector_size * node_id + i]; }
+      }
+    }
+    double volume;
+    element_->ComputeVolumeAverage(coord.data(), 0, nullptr, volume, nullptr);
+    for (int node = 0; node < num_node_per_elem; node++) {
+      nodal_volume[elem_conn[elem * num_node_per_elem + node]] += volume / num_node_per_elem;
+    }
+  }
+}
+
+void
+ElementTiling::Build(
+    int                      num_elem,
+    int                      num_node_per_elem,
+    const int*               elem_conn,
+    int                      max_nodes_per_tile,
+    int                      min_num_tiles,
+    const std::vector<char>* node_is_shared)
+{
+  elem_conn_ = elem_conn;
+  num_elem_  = num_elem;
+  tile_first_elem.assign(1, 0);
+  tile_first_node.assign(1, 0);
+  tile_elems.clear();
+  tile_elems.reserve(num_elem);
+  tile_node_ids.clear();
+  local_elem_conn.resize(num_elem * num_node_per_elem);
+
+  int max_node_id = -1;
+  for (int i = 0; i < num_elem * num_node_per_elem; i++) { max_node_id = std::max(max_node_id, elem_conn[i]); }
+
+  // Elements attached to each node, in compressed row storage
+  std::vector<int> node_first_elem(max_node_id + 2, 0);
+  for (int i = 0; i < num_elem * num_node_per_elem; i++) { node_first_elem[elem_conn[i] + 1]++; }
+  int num_nodes = 0;
+  for (int node_id = 0; node_id <= max_node_id; node_id++) {
+    if (node_first_elem[node_id + 1] > 0) num_nodes++;
+    node_first_elem[node_id + 1] += node_first_elem[node_id];
+  }
+  std::vector<int> node_elems(num_elem * num_node_per_elem);
+  std::vector<int> next_entry(node_first_elem.begin(), node_first_elem.end() - 1);
+  for (int elem = 0; elem < num_elem; elem++) {
+    for (int node = 0; node < num_node_per_elem; node++) {
+      node_elems[next_entry[elem_conn[elem * num_node_per_elem + node]]++] = elem;
+    }
+  }
+
+  if (min_num_tiles > 1) {
+    max_nodes_per_tile = std::min(max_nodes_per_tile, std::max(num_node_per_elem, num_nodes / min_num_tiles));
+  }
+
+  // Elements touching a shared node, a tile holds either only these or none of them
+  std::vector<char> elem_is_boundary(num_elem, 0);
+  if (node_is_shared != nullptr) {
+    for (int elem = 0; elem < num_elem; elem++) {
+      for (int node = 0; node < num_node_per_elem && !elem_is_boundary[elem]; node++) {
+        elem_is_boundary[elem] = (*node_is_shared)[elem_conn[elem * num_node_per_elem + node]];
+      }
+    }
+  }
+
+  // Breadth-first sweep over the elements reachable from seed, appended to queue,
+  // skipping the elements flagged in is_done. Returns the last element reached.
+  std::vector<char> is_done(num_elem, 0);
+  auto              sweep = [&](int seed, std::vector<int>& queue) {
+    is_done[seed] = 1;
+    queue.push_back(seed);
+    for (std::size_t head = queue.size() - 1; head < queue.size(); head++) {
+      const int* conn = &elem_conn[queue[head] * num_node_per_elem];
+      for (int node = 0; node < num_node_per_elem; node++) {
+        for (int k = node_first_elem[conn[node]]; k < node_first_elem[conn[node] + 1]; k++) {
+          if (!is_done[node_elems[k]]) {
+            is_done[node_elems[k]] = 1;
+            queue.push_back(node_elems[k]);
+          }
+        }
+      }
+    }
+    return queue.back();
+  };
+
+  // Seed order: one sweep per connected part, started from the last element reached
+  // by a first sweep, so that the tiles advance as a front from the edge of the part
+  std::vector<int> seed_order;
+  seed_order.reserve(num_elem);
+  for (int elem = 0; elem < num_elem; elem++) {
+    if (is_done[elem]) continue;
+    std::size_t part_begin = seed_order.size();
+    int         far_elem   = sweep(elem, seed_order);
+    for (std::size_t k = part_begin; k < seed_order.size(); k++) { is_done[seed_order[k]] = 0; }
+    seed_order.resize(part_begin);
+    sweep(far_elem, seed_order);
+  }
+
+  // Index of each node within the current tile, -1 when it is not in the tile
+  std::vector<int> local_index(max_node_id + 1, -1);
+
+  // Each tile grows breadth-first from the first element not yet in a tile,
+  // over the elements on the same side of the rank boundary, until the next
+  // element would exceed the node bound
+  boundary_tiles.clear();
+  interior_tiles.clear();
+  std::fill(is_done.begin(), is_done.end(), 0);
+  std::vector<char> is_queued(num_elem, 0);
+  std::vector<int>  queue;
+  for (int seed : seed_order) {
+    if (is_done[seed]) continue;
+    queue.assign(1, seed);
+    is_queued[seed] = 1;
+    for (std::size_t head = 0; head < queue.size(); head++) {
+      int        elem           = queue[head];
+      const int* conn           = &elem_conn[elem * num_node_per_elem];
+      int        num_new_nodes  = 0;
+      int        num_tile_nodes = static_cast<int>(tile_node_ids.size()) - tile_first_node.back();
+      for (int node = 0; node < num_node_per_elem; node++) {
+        if (local_index[conn[node]] < 0) num_new_nodes++;
+      }
+      if (num_tile_nodes > 0 && num_tile_nodes + num_new_nodes > max_nodes_per_tile) break;
+
+      is_done[elem] = 1;
+      tile_elems.push_back(elem);
+      for (int node = 0; node < num_node_per_elem; node++) {
+        int node_id = conn[node];
+        if (local_index[node_id] < 0) {
+          local_index[node_id] = static_cast<int>(tile_node_ids.size()) - tile_first_node.back();
+          tile_node_ids.push_back(node_id);
+        }
+        local_elem_conn[elem * num_node_per_elem + node] = local_index[node_id];
+        for (int k = node_first_elem[node_id]; k < node_first_elem[node_id + 1]; k++) {
+          int neighbor = node_elems[k];
+          if (!is_done[neighbor] && !is_queued[neighbor] && elem_is_boundary[neighbor] == elem_is_boundary[seed]) {
+            is_queued[neighbor] = 1;
+            queue.push_back(neighbor);
+          }
+        }
+      }
+    }
+    for (int elem : queue) { is_queued[elem] = 0; }
+    // Increasing element indices within the tile, to stream through the element data
+    std::sort(tile_elems.begin() + tile_first_elem.back(), tile_elems.end());
+    for (int k = tile_first_node.back(); k < static_cast<int>(tile_node_ids.size()); k++) {
+      local_index[tile_node_ids[k]] = -1;
+    }
+    if (node_is_shared != nullptr) {
+      (elem_is_boundary[seed] ? boundary_tiles : interior_tiles).push_back(NumTiles());
+    }
+    tile_first_elem.push_back(static_cast<int>(tile_elems.size()));
+    tile_first_node.push_back(static_cast<int>(tile_node_ids.size()));
+  }
 }
 
 void
@@ -442,7 +984,7 @@ Block::ComputeDerivedElementData(
     int                               num_elem,
     const int* const                  elem_conn,
     int                               num_elem_data,
-    std::vector<double> const&        elem_data_np1,
+    std::vector<StateScalar> const&   elem_data_np1,
     int                               num_derived_elem_data,
     std::vector<std::vector<double>>& derived_elem_data)
 {
@@ -61,6 +61,120 @@ class MaterialFactory;
 
 namespace nimble {
 
+/// \brief Per-element data to skip the update of sleeping elements
+///
+/// A sleeping element keeps its state at step n and adds its last nodal
+/// force contribution to the internal force instead of recomputing it.
+struct ElementActivity
+{
+  //! Flag for each element, zero when the element is asleep
+  std::vector<char> is_awake;
+
+  //! Largest component of F^{n+1} - F^{n} over the integration points at the last update
+  std::vector<double> strain_increment;
+
+  //! Nodal force contribution of each element at the last update
+  std::vector<double> nodal_force;
+};
+
+/// \brief Subset of the element tiles processed by an internal force evaluation
+///
+/// Boundary tiles hold the elements with at least one node shared with another
+/// rank. Once they are processed the force at the shared nodes is final, so its
+/// reduction can proceed while the interior tiles are processed.
+enum TileSubset
+{
+  ALL_TILES      = 0,
+  BOUNDARY_TILES = 1,
+  INTERIOR_TILES = 2
+};
+
+/// \brief Partition of a block into tiles of neighboring elements
+///
+/// Each tile has a bounded number of distinct nodes, so that their data can be
+/// gathered into compact buffers that stay in cache while the element kernels
+/// run. Each tile grows breadth-first on the element graph (elements sharing a
+/// node are neighbors), so it holds a compact patch of the mesh whatever the
+/// numbering of the elements.
+struct ElementTiling
+{
+  /// \brief Build the tiles, each with at most max_nodes_per_tile distinct nodes
+  ///
+  /// The node bound is lowered when needed so that there are at least
+  /// min_num_tiles tiles to share among the threads.
+  ///
+  /// \param node_is_shared Flag for each node, nonzero when it is shared with another
+  /// rank. When given, no tile mixes elements touching a shared node with the other
+  /// elements, and the tiles are split into boundary and interior tiles.
+  void
+  Build(
+      int                      num_elem,
+      int                      num_node_per_elem,
+      const int*               elem_conn,
+      int                      max_nodes_per_tile,
+      int                      min_num_tiles  = 1,
+      const std::vector<char>* node_is_shared = nullptr);
+
+  /// \brief Return true when the tiling was built for this connectivity
+  bool
+  Matches(int num_elem, const int* elem_conn) const
+  {
+    return elem_conn == elem_conn_ && num_elem == num_elem_;
+  }
+
+  int
+  NumTiles() const
+  {
+    return static_cast<int>(tile_first_elem.size()) - 1;
+  }
+
+  /// \brief Return true when the last build split the tiles into boundary and interior tiles
+  bool
+  IsClassified() const
+  {
+    return !boundary_tiles.empty() || !interior_tiles.empty();
+  }
+
+  //! First entry of each tile in tile_elems, followed by the number of elements
+  std::vector<int> tile_first_elem;
+
+  //! Element indices of each tile, increasing within a tile
+  std::vector<int> tile_elems;
+
+  //! First entry of each tile in tile_node_ids, followed by the size of tile_node_ids
+  std::vector<int> tile_first_node;
+
+  //! Distinct node ids of each tile
+  std::vector<int> tile_node_ids;
+
+  //! Element connectivity in terms of the node indices within the tile
+  std::vector<int> local_elem_conn;
+
+  //! Tiles of the elements with at least one node shared with another rank
+  std::vector<int> boundary_tiles;
+
+  //! Tiles of the elements whose nodes all belong to this rank only
+  std::vector<int> interior_tiles;
+
+ private:
+  const int* elem_conn_{nullptr};
+  int        num_elem_{-1};
+};
+
+/// \brief Scratch arrays of one thread, reused for all the tiles it processes
+struct ElementTileWorkspace
+{
+  //! Node data gathered for the current tile
+  std::vector<double> tile_reference_coordinates, tile_displacement, tile_force, tile_jacobian;
+
+  //! Element-minor arrays for one batch of NIMBLE_ELEMENT_BATCH_WIDTH elements
+  int                 elem_ids[NIMBLE_ELEMENT_BATCH_WIDTH];
+  std::vector<double> ref_coord, cur_coord, force;
+  std::vector<double> def_grad_n, def_grad_np1;
+  std::vector<double> stress_n, stress_np1;
+  std::vector<double> state_data_n, state_data_np1;
+};
+
 class Block : public nimble::BlockBase
 {
  public:
@@ -74,6 +188,8 @@ class Block : public nimble::BlockBase
   serialize(ArchiveType& ar)
   {
     ar | model_material_parameters_;
+    ar | element_type_;
+    ar | element_formulation_;
     ar | def_grad_offset_;
     ar | stress_offset_;
     ar | state_data_offset_;
@@ -93,8 +209,18 @@ class Block : public nimble::BlockBase
   }
 #endif
 
+  /// \brief Create the material model and the element
+  ///
+  /// \param element_type Element type from GenesisMesh::GetElementType(), HEX, TETRA or TETRA10
+  /// \param element_formulation Formulation from Parser::GetElementFormulation(), "composite"
+  /// selects CompositeTet10Element, "nodal_averaged" averages the volume change of TETRA
+  /// elements at the nodes
   void
-  Initialize(std::string const& model_material_parameters, MaterialFactory& factory);
+  Initialize(
+      std::string const& model_material_parameters,
+      std::string const& element_type,
+      std::string const& element_formulation,
+      MaterialFactory&   factory);
 
   void
   InstantiateMaterialModel(MaterialFactory& factory);
@@ -118,11 +244,16 @@ class Block : public nimble::BlockBase
       std::vector<int> const&         elem_global_ids_in_block,
       std::vector<std::string> const& elem_data_labels,
       std::vector<std::string> const& derived_elem_data_labels,
-      std::vector<double>&            elem_data_n,
-      std::vector<double>&            elem_data_np1,
+      std::vector<StateScalar>&       elem_data_n,
+      std::vector<StateScalar>&       elem_data_np1,
       MaterialFactory&                material_factory,
       DataManager&                    data_manager);
 
+  /// \brief Compute the stress and add the nodal forces of the block
+  ///
+  /// With nodal averaging, nodal_jacobian holds the volume ratio of each node,
+  /// see ModelData::UpdateNodalJacobian(), and the deformation gradient of each
+  /// element is scaled to the average over its nodes.
   void
   ComputeInternalForce(
       const double*                   reference_coordinates,
@@ -135,11 +266,30 @@ class Block : public nimble::BlockBase
       const int*                      elem_conn,
       const int*                      elem_global_ids,
       std::vector<std::string> const& elem_data_labels,
-      std::vector<double> const&      elem_data_n,
-      std::vector<double>&            elem_data_np1,
+      std::vector<StateScalar> const& elem_data_n,
+      std::vector<StateScalar>&       elem_data_np1,
       DataManager&                    data_manager,
       bool                            is_output_step,
-      bool                            compute_stress_only = false) const;
+      bool                            compute_stress_only = false,
+      ElementActivity*                activity            = nullptr,
+      TileSubset                      tile_subset         = ALL_TILES,
+      const std::vector<char>*        node_is_shared      = nullptr,
+      const double*                   nodal_jacobian      = nullptr) const;
+
+  /// \brief Add the volume of each element, split evenly over its nodes
+  ///
+  /// \param reference_coordinates Nodal reference coordinates
+  /// \param displacement Nodal displacements, nullptr for the reference volume
+  /// \param num_elem Number of elements in the block
+  /// \param elem_conn Element connectivity
+  /// \param nodal_volume Nodal volume, incremented
+  void
+  ComputeNodalVolume(
+      const double* reference_coordinates,
+      const double* displacement,
+      int           num_elem,
+      const int*    elem_conn,
+      double*       nodal_volume) const;
 
   void
   ComputeDerivedElementData(
@@ -148,7 +298,7 @@ class Block : public nimble::BlockBase
       int                               num_elem,
       const int* const                  elem_conn,
       int                               num_elem_data,
-      std::vector<double> const&        elem_data_np1,
+      std::vector<StateScalar> const&   elem_data_np1,
       int                               num_derived_elem_data,
       std::vector<std::vector<double>>& derived_elem_data);
 
@@ -164,6 +314,18 @@ class Block : public nimble::BlockBase
   int                vol_ave_volume_offset_;
   std::vector<int>   vol_ave_offsets_;
   std::map<int, int> vol_ave_index_to_derived_data_index_;
+
+  //! Cache budget for the node data gathered by a tile (reference coordinates, displacement, force)
+  static constexpr int tile_cache_bytes_ = 32 * 1024;
+
+  //! Minimum number of tiles per thread, so that the threads stay busy until the last tiles
+  static constexpr int tiles_per_thread_ = 4;
+
+  //! Element tiles, built on the first internal force evaluation
+  mutable ElementTiling tiling_;
+
+  //! Scratch arrays, one set per thread
+  mutable std::vector<ElementTileWorkspace> tile_workspaces_;
 };
 
 }  // namespace nimble
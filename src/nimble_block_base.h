@@ -94,6 +94,13 @@ class BlockBase
     return element_;
   }
 
+  /// \brief Return true when the volume change of the block is averaged at the nodes
+  bool
+  UsesNodalAveraging() const
+  {
+    return element_formulation_ == "nodal_averaged";
+  }
+
   virtual double
   ComputeCriticalTimeStep(
       const nimble::Viewify<2>& node_reference_coordinates,
@@ -114,6 +121,8 @@ class BlockBase
 
  protected:
   std::string               model_material_parameters_ = "none";
+  std::string               element_type_              = "HEX";
+  std::string               element_formulation_       = "standard";
   std::shared_ptr<Element>  element_                   = nullptr;
   std::shared_ptr<Material> material_                  = nullptr;
 };
@@ -65,7 +65,9 @@ BoundaryConditionManager::Initialize(
 
   if (time_integration_scheme == "explicit") {
     time_integration_scheme_ = EXPLICIT;
-  } else if (time_integration_scheme == "quasistatic") {
+  } else if (
+      time_integration_scheme == "quasistatic" || time_integration_scheme == "dynamic relaxation" ||
+      time_integration_scheme == "implicit dynamics") {
     time_integration_scheme_ = QUASISTATIC;
   }
 
@@ -47,6 +47,8 @@
 #include "nimble_boundary_condition.h"
 #include "nimble_view.h"
 
+#include <utility>
+
 #ifdef NIMBLE_HAVE_DARMA
 #include "darma.h"
 #else
@@ -216,6 +218,79 @@ class BoundaryConditionManager
     ApplyKinematicBC(time_current, time_previous, reference_coordinates, displacement, velocity, empty);
   }
 
+  /// \brief Flatten the kinematic conditions into one entry per degree of freedom
+  ///
+  /// \param[in] time_current Time used to evaluate expressions
+  /// \param[in] reference_coordinates Reference coordinates used to evaluate expressions
+  /// \param[out] node_ids Node of each entry
+  /// \param[out] coordinates Coordinate of each entry
+  /// \param[out] is_displacement 1 when the entry prescribes a displacement, 0 for a velocity
+  /// \param[out] values Prescribed velocity or displacement
+  ///
+  /// \note Later conditions override earlier ones on the same degree of freedom,
+  ///       as they do in ApplyKinematicBC, so the entries can be applied concurrently.
+  template <typename ViewT>
+  void
+  GetKinematicBCEntries(
+      double               time_current,
+      const ViewT          reference_coordinates,
+      std::vector<int>&    node_ids,
+      std::vector<int>&    coordinates,
+      std::vector<int>&    is_displacement,
+      std::vector<double>& values)
+  {
+    std::map<std::pair<int, int>, int> dof_to_entry;
+    node_ids.clear();
+    coordinates.clear();
+    is_displacement.clear();
+    values.clear();
+    for (auto& bc : boundary_conditions_) {
+      if (bc.bc_type_ != BoundaryCondition::PRESCRIBED_VELOCITY &&
+          bc.bc_type_ != BoundaryCondition::PRESCRIBED_DISPLACEMENT) {
+        continue;
+      }
+      int                     coordinate = bc.coordinate_;
+      int                     type       = (bc.bc_type_ == BoundaryCondition::PRESCRIBED_DISPLACEMENT) ? 1 : 0;
+      std::vector<int> const& node_set   = node_sets_[bc.node_set_id_];
+      for (int n : node_set) {
+        double value = bc.magnitude_;
+        if (bc.has_expression_) {
+          bc.expression_.x = reference_coordinates(n, 0);
+          bc.expression_.y = reference_coordinates(n, 1);
+          bc.expression_.z = 0.0;
+          if (dim_ == 3) { bc.expression_.z = reference_coordinates(n, 2); }
+          bc.expression_.t = time_current;
+          value            = bc.expression_.eval();
+        }
+        auto it = dof_to_entry.find(std::make_pair(n, coordinate));
+        if (it == dof_to_entry.end()) {
+          dof_to_entry[std::make_pair(n, coordinate)] = static_cast<int>(node_ids.size());
+          node_ids.push_back(n);
+          coordinates.push_back(coordinate);
+          is_displacement.push_back(type);
+          values.push_back(value);
+        } else {
+          is_displacement[it->second] = type;
+          values[it->second]          = value;
+        }
+      }
+    }
+  }
+
+  /// \brief Return true when a kinematic condition depends on an expression
+  bool
+  HasKinematicBCExpression() const
+  {
+    for (auto const& bc : boundary_conditions_) {
+      if ((bc.bc_type_ == BoundaryCondition::PRESCRIBED_VELOCITY ||
+           bc.bc_type_ == BoundaryCondition::PRESCRIBED_DISPLACEMENT) &&
+          bc.has_expression_) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   template <typename MatT>
   void
   ModifyTangentStiffnessMatrixForKinematicBC(
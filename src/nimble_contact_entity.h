@@ -300,6 +300,37 @@ class ContactEntity
     }
   }
 
+#ifdef NIMBLE_HAVE_KOKKOS
+  /// \brief Add the entity forces through a Kokkos ScatterView access
+  ///
+  /// \param force Result of ScatterView::access() on the contact manager force
+  template <typename ScatterAccessT>
+  NIMBLE_INLINE_FUNCTION void
+  ScatterForceUsingScatterAccess(ScatterAccessT const& force) const
+  {
+    int n = 3 * node_id_for_node_1_;
+    force(n) += force_1_x_;
+    force(n + 1) += force_1_y_;
+    force(n + 2) += force_1_z_;
+    if (entity_type_ == TRIANGLE) {
+      n = 3 * node_id_for_node_2_;
+      force(n) += force_2_x_;
+      force(n + 1) += force_2_y_;
+      force(n + 2) += force_2_z_;
+      const int list[4] = {
+          3 * node_id_1_for_fictitious_node_,
+          3 * node_id_2_for_fictitious_node_,
+          3 * node_id_3_for_fictitious_node_,
+          3 * node_id_4_for_fictitious_node_};
+      for (const auto nf : list) {
+        force(nf) += force_3_x_ / 4.0;
+        force(nf + 1) += force_3_y_ / 4.0;
+        force(nf + 2) += force_3_z_ / 4.0;
+      }
+    }
+  }
+#endif
+
   // functions required for NimbleSMExtras contact search
   NIMBLE_INLINE_FUNCTION
   double
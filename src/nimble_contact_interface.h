@@ -79,13 +79,23 @@ struct KokkosPenaltyContactEnforcement
       face.ComputeNodalContactForces(contact_force, closest_pt);
       for (double& ff : contact_force) { ff *= -1.0; }
       node.ComputeNodalContactForces(contact_force, closest_pt);
+#ifndef KOKKOS_ENABLE_QTHREADS
+      auto contact_manager_force_access = contact_manager_force_scatter.access();
+      node.ScatterForceUsingScatterAccess(contact_manager_force_access);
+      face.ScatterForceUsingScatterAccess(contact_manager_force_access);
+#else
       node.ScatterForceToContactManagerForceVector(contact_manager_force);
       face.ScatterForceToContactManagerForceVector(contact_manager_force);
+#endif
     }
   }
 
   double                              penalty;
   nimble_kokkos::DeviceScalarNodeView contact_manager_force;
+#ifndef KOKKOS_ENABLE_QTHREADS
+  //! Scatter view of contact_manager_force, contributed after each enforcement
+  nimble_kokkos::DeviceScalarNodeScatterView contact_manager_force_scatter;
+#endif
 };
 
 #endif
@@ -109,21 +119,47 @@ class ContactInterface
   void
   SetContactForce(nimble_kokkos::DeviceScalarNodeView contact_manager_force)
   {
-    enforcement.contact_manager_force = contact_manager_force;
+    SetEnforcementForce(contact_manager_force);
   }
 
+  /// \brief Search and enforcement pass of one contact interaction
+  ///
+  /// \note The penalty is part of every pass, as one interface may serve several
+  /// interactions with different penalties
   void
   ComputeContact(
       nimble_kokkos::DeviceContactEntityArrayView contact_nodes,
       nimble_kokkos::DeviceContactEntityArrayView contact_faces,
-      nimble_kokkos::DeviceScalarNodeView         contact_manager_force)
+      nimble_kokkos::DeviceScalarNodeView         contact_manager_force,
+      const double                                penalty_param)
   {
     ZeroContactForces(contact_manager_force);
-    enforcement.contact_manager_force = contact_manager_force;
+    SetUpPenaltyEnforcement(penalty_param);
+    SetEnforcementForce(contact_manager_force);
+#ifndef KOKKOS_ENABLE_QTHREADS
+    enforcement.contact_manager_force_scatter.reset();
+#endif
     DoSearchAndEnforcement(contact_nodes, contact_faces, enforcement);
+#ifndef KOKKOS_ENABLE_QTHREADS
+    Kokkos::Experimental::contribute(contact_manager_force, enforcement.contact_manager_force_scatter);
+#endif
   }
 
  protected:
+  /// \brief Point the enforcement at a force view, rebuilding the scatter view
+  /// only when the view changes
+  inline void
+  SetEnforcementForce(nimble_kokkos::DeviceScalarNodeView contact_manager_force)
+  {
+#ifndef KOKKOS_ENABLE_QTHREADS
+    if (enforcement.contact_manager_force.data() != contact_manager_force.data() ||
+        enforcement.contact_manager_force_scatter.extent(0) != contact_manager_force.extent(0)) {
+      enforcement.contact_manager_force_scatter = Kokkos::Experimental::create_scatter_view(contact_manager_force);
+    }
+#endif
+    enforcement.contact_manager_force = contact_manager_force;
+  }
+
   inline void
   ZeroContactForces(nimble_kokkos::DeviceScalarNodeView contact_manager_force) const
   {
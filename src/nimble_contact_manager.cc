@@ -99,6 +99,7 @@
 #include <algorithm>
 #include <iostream>
 #include <set>
+#include <sstream>
 #include <type_traits>
 #include <utility>
 
@@ -160,11 +161,68 @@ ParseContactCommand(
   ss >> penalty_parameter;
 }
 
+ContactInteraction
+ParseContactInteraction(std::string const& command, std::string const& default_name, int default_dicing)
+{
+  ContactInteraction interaction;
+  interaction.name   = default_name;
+  interaction.dicing = default_dicing;
+
+  std::vector<std::string> tokens;
+  {
+    std::stringstream ss(command);
+    std::string       token;
+    while (ss >> token) tokens.push_back(token);
+  }
+
+  // optional leading "name <label>"
+  std::size_t first = 0;
+  if (!tokens.empty() && tokens[0] == "name") {
+    if (tokens.size() < 2) {
+      throw std::invalid_argument("\n**** Error processing contact command, expected a label after \"name\".\n");
+    }
+    interaction.name = tokens[1];
+    first            = 2;
+  }
+
+  // optional trailing "dicing <n>"
+  std::size_t last = tokens.size();
+  if (last >= first + 2 && tokens[last - 2] == "dicing") {
+    interaction.dicing = std::stoi(tokens[last - 1]);
+    if (interaction.dicing < 1) {
+      throw std::invalid_argument("\n**** Error processing contact command, \"dicing\" must be positive.\n");
+    }
+    last -= 2;
+  }
+
+  std::stringstream remainder;
+  for (std::size_t i = first; i < last; ++i) remainder << tokens[i] << " ";
+  ParseContactCommand(
+      remainder.str(),
+      interaction.primary_block_names,
+      interaction.secondary_block_names,
+      interaction.penalty_parameter);
+
+  return interaction;
+}
+
 std::shared_ptr<nimble::ContactManager>
 GetContactManager(std::shared_ptr<ContactInterface> interface, nimble::DataManager& data_manager)
 {
   if (!data_manager.GetParser().HasContact()) return nullptr;
 
+  auto const& parser      = data_manager.GetParser();
+  auto const  interaction = ParseContactInteraction(parser.ContactString(), "contact", parser.ContactDicing());
+  return GetContactManager(interface, data_manager, interaction);
+}
+
+std::shared_ptr<nimble::ContactManager>
+GetContactManager(
+    std::shared_ptr<ContactInterface> interface,
+    nimble::DataManager&              data_manager,
+    ContactInteraction const&         interaction)
+{
+
 #if defined(NIMBLE_HAVE_ARBORX)
   if (data_manager.GetParser().UseKokkos()) {
 #if defined(ARBORX_ENABLE_MPI) && defined(NIMBLE_HAVE_MPI)
@@ -177,14 +235,52 @@ GetContactManager(std::shared_ptr<ContactInterface> interface, nimble::DataManag
 
 #ifdef NIMBLE_HAVE_BVH
   if (data_manager.GetParser().UseVT()) {
-    return std::make_shared<nimble::BvhContactManager>(
-        interface, data_manager, data_manager.GetParser().ContactDicing());
+    return std::make_shared<nimble::BvhContactManager>(interface, data_manager, interaction.dicing);
   }
 #endif
 
+  // The brute force search only pairs the entities of the same rank, the
+  // contact across the rank boundaries would be missed
+  if (data_manager.GetParser().GetNumRanks() > 1) {
+    throw std::invalid_argument(
+        "\n**** Error in GetContactManager(), the brute force contact search runs on a single rank only, "
+        "use the BVH (--use_vt) or ArborX (--use_kokkos) contact managers with several ranks.\n");
+  }
+
   return std::make_shared<nimble::ContactManager>(interface, data_manager);
 }
 
+void
+ComputeContactForce(
+    std::vector<std::shared_ptr<nimble::ContactManager>> const& contact_managers,
+    nimble::Viewify<2>                                          contact_force)
+{
+  ComputeLocalContactForce(contact_managers, contact_force);
+  ReduceContactForce(contact_managers, contact_force);
+}
+
+void
+ComputeLocalContactForce(
+    std::vector<std::shared_ptr<nimble::ContactManager>> const& contact_managers,
+    nimble::Viewify<2>                                          contact_force)
+{
+  if (contact_managers.empty()) return;
+
+  // Every manager adds the force of its own interaction, and the reduction is
+  // linear, so the summed field is reduced once
+  contact_managers.front()->ResetContactForce(contact_force);
+  for (auto const& contact_manager : contact_managers)
+    contact_manager->ComputeLocalContactForce(contact_force);
+}
+
+void
+ReduceContactForce(
+    std::vector<std::shared_ptr<nimble::ContactManager>> const& contact_managers,
+    nimble::Viewify<2>                                          contact_force)
+{
+  if (!contact_managers.empty()) contact_managers.front()->ReduceContactForce(contact_force);
+}
+
 //
 // Interface functions
 //
@@ -420,7 +516,28 @@ ContactManager::CreateContactEntities(
 }
 
 void
-ContactManager::ComputeContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force)
+ContactManager::ComputeContactForce(nimble::Viewify<2> contact_force)
+{
+  ResetContactForce(contact_force);
+  ComputeLocalContactForce(contact_force);
+  ReduceContactForce(contact_force);
+}
+
+void
+ContactManager::ResetContactForce(nimble::Viewify<2> contact_force)
+{
+  contact_force.zero();
+#ifdef NIMBLE_HAVE_KOKKOS
+  if (data_manager_.GetParser().UseKokkos()) {
+    auto model_data      = dynamic_cast<nimble_kokkos::ModelData*>(data_manager_.GetModelData().get());
+    auto contact_force_d = model_data->GetDeviceVectorNodeData(data_manager_.GetFieldIDs().contact_force);
+    Kokkos::deep_copy(contact_force_d, (double)(0.0));
+  }
+#endif
+}
+
+void
+ContactManager::ComputeLocalContactForce(nimble::Viewify<2> contact_force)
 {
   if (penalty_parameter_ <= 0.0) {
     throw std::invalid_argument("\nError in ComputeContactForce(), invalid penalty_parameter.\n");
@@ -435,21 +552,18 @@ ContactManager::ComputeContactForce(int step, bool debug_output, nimble::Viewify
     auto field_ids       = data_manager_.GetFieldIDs();
     auto displacement_d  = model_data->GetDeviceVectorNodeData(field_ids.displacement);
     auto contact_force_d = model_data->GetDeviceVectorNodeData(field_ids.contact_force);
-    Kokkos::deep_copy(contact_force_d, (double)(0.0));
+    auto contact_force_h = model_data->GetHostVectorNodeData(field_ids.contact_force);
+    NIMBLE_ASSERT(
+        contact_force.data() == contact_force_h.data(),
+        "\nError in ComputeContactForce(), contact_force is not the host field.\n");
     //
     ApplyDisplacements(displacement_d);
     //
-    ComputeContactForce(step, debug_output);
+    ComputeContactForce();
     //
-    GetForces(contact_force_d);
+    AddForces(contact_force_d);
     //
-    auto contact_force_h = model_data->GetHostVectorNodeData(field_ids.contact_force);
     Kokkos::deep_copy(contact_force_h, contact_force_d);
-#ifdef NIMBLE_HAVE_MPI
-    auto          myVectorCommunicator = data_manager_.GetVectorCommunicator();
-    constexpr int vector_dim           = 3;
-    myVectorCommunicator->VectorReduction(vector_dim, contact_force_h);
-#endif
     return;
 #endif
   }
@@ -458,9 +572,20 @@ ContactManager::ComputeContactForce(int step, bool debug_output, nimble::Viewify
   auto displacement = model_data->GetVectorNodeData("displacement");
   ApplyDisplacements(displacement.data());
 
-  ComputeContactForce(step, debug_output);
+  for (auto& fval : force_) fval = 0.0;
+  for (auto& contact_face : contact_faces_) contact_face.set_contact_status(false);
+  for (auto& contact_node : contact_nodes_) contact_node.set_contact_status(false);
+
+  startTimer("Contact::EnforceInteraction");
+  BruteForceBoxIntersectionSearch(contact_nodes_, contact_faces_);
+  stopTimer("Contact::EnforceInteraction");
+
+  AddForces(contact_force.data());
+}
 
-  GetForces(contact_force.data());
+void
+ContactManager::ReduceContactForce(nimble::Viewify<2> contact_force)
+{
 #ifdef NIMBLE_HAVE_MPI
   auto          myVectorCommunicator = data_manager_.GetVectorCommunicator();
   constexpr int vector_dim           = 3;
@@ -742,18 +867,18 @@ ContactManager::ApplyDisplacements(const double* displacement)
 }
 
 void
-ContactManager::GetForces(double* contact_force) const
+ContactManager::AddForces(double* contact_force) const
 {
   for (unsigned int i_node = 0; i_node < node_ids_.size(); i_node++) {
     int node_id = node_ids_[i_node];
-    for (int i = 0; i < 3; i++) { contact_force[3 * node_id + i] = force_[3 * i_node + i]; }
+    for (int i = 0; i < 3; i++) { contact_force[3 * node_id + i] += force_[3 * i_node + i]; }
   }
 }
 
 #ifdef NIMBLE_HAVE_KOKKOS
-// Kokkos Versions of GetForces and ApplyDisplacements
+// Kokkos Versions of AddForces and ApplyDisplacements
 void
-ContactManager::GetForces(nimble_kokkos::DeviceVectorNodeView contact_force_d) const
+ContactManager::AddForces(nimble_kokkos::DeviceVectorNodeView contact_force_d) const
 {
   int num_nodes_in_contact_manager = node_ids_d_.extent(0);
 
@@ -762,11 +887,11 @@ ContactManager::GetForces(nimble_kokkos::DeviceVectorNodeView contact_force_d) c
   nimble_kokkos::DeviceScalarNodeView   force    = force_d_;
 
   Kokkos::parallel_for(
-      "ContactManager::GetForces", num_nodes_in_contact_manager, KOKKOS_LAMBDA(const int i) {
+      "ContactManager::AddForces", num_nodes_in_contact_manager, KOKKOS_LAMBDA(const int i) {
         int node_id                 = node_ids(i);
-        contact_force_d(node_id, 0) = force(3 * i);
-        contact_force_d(node_id, 1) = force(3 * i + 1);
-        contact_force_d(node_id, 2) = force(3 * i + 2);
+        contact_force_d(node_id, 0) += force(3 * i);
+        contact_force_d(node_id, 1) += force(3 * i + 1);
+        contact_force_d(node_id, 2) += force(3 * i + 2);
       });
 }
 
@@ -1313,13 +1438,26 @@ ContactManager::BoundingBoxAverageCharacteristicLengthOverAllRanks() const
 }
 
 void
-ContactManager::BruteForceBoxIntersectionSearch(
-    std::vector<ContactEntity> const& nodes,
-    std::vector<ContactEntity> const& triangles)
+ContactManager::BruteForceBoxIntersectionSearch(std::vector<ContactEntity>& nodes, std::vector<ContactEntity>& triangles)
 {
-  for (int i_node = 0; i_node < nodes.size(); i_node++) {
-    for (int i_tri = 0; i_tri < triangles.size(); i_tri++) {
-      // ContactEntity.get_x_min()
+  for (auto& node : nodes) {
+    for (auto& tri : triangles) {
+      if (node.get_x_max() < tri.get_x_min() || tri.get_x_max() < node.get_x_min()) continue;
+      if (node.get_y_max() < tri.get_y_min() || tri.get_y_max() < node.get_y_min()) continue;
+      if (node.get_z_max() < tri.get_z_min() || tri.get_z_max() < node.get_z_min()) continue;
+
+      double gap                  = 0.0;
+      double normal[3]            = {0., 0., 0.};
+      bool   inside               = false;
+      double facet_coordinates[3] = {0., 0., 0.};
+
+      //--- Determine whether the node is projected inside the triangular face
+      Projection(node, tri, inside, gap, &normal[0], &facet_coordinates[0]);
+      if (inside) {
+        tri.set_contact_status(true);
+        node.set_contact_status(true);
+        EnforceNodeFaceInteraction(node, tri, gap, normal, facet_coordinates, force_);
+      }
     }
   }
 }
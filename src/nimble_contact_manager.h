@@ -50,6 +50,7 @@
 #include <memory>
 #include <unordered_map>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "nimble_contact_entity.h"
@@ -167,7 +168,6 @@ class ContactManager
   {
     penalty_parameter_  = penalty_parameter;
     enforcement.penalty = penalty_parameter_;
-    contact_interface->SetUpPenaltyEnforcement(penalty_parameter_);
   }
 
   /// \brief Create contact entities between different blocks
@@ -197,12 +197,43 @@ class ContactManager
 
   /// \brief Compute the contact force
   ///
-  /// \param data_manager
-  /// \param step
-  /// \param debug_output
+  /// \param contact_force
+  ///
+  /// \note Equivalent to ResetContactForce, ComputeLocalContactForce and ReduceContactForce
+  virtual void
+  ComputeContactForce(nimble::Viewify<2> contact_force);
+
+  /// \brief Zero the contact force field, on the device as well when using Kokkos
+  ///
+  /// \param contact_force
+  void
+  ResetContactForce(nimble::Viewify<2> contact_force);
+
+  /// \brief Add the contact force of the entities owned by this rank to contact_force
+  ///
+  /// \param contact_force
+  ///
+  /// \note The force is added, so that several interactions can share the field.
+  /// It must be preceded by ResetContactForce and followed by ReduceContactForce.
+  /// On the host, the search pairs the contact nodes and faces of this rank only.
+  virtual void
+  ComputeLocalContactForce(nimble::Viewify<2> contact_force);
+
+  /// \brief Sum the contact force over the ranks
+  ///
   /// \param contact_force
   virtual void
-  ComputeContactForce(int step, bool debug_output, nimble::Viewify<2> contact_force);
+  ReduceContactForce(nimble::Viewify<2> contact_force);
+
+  /// \brief Indicate whether ComputeLocalContactForce runs without communication,
+  /// so that it may run concurrently with other work
+  ///
+  /// \return False when the search itself communicates across ranks
+  virtual bool
+  HasLocalContactForce() const
+  {
+    return true;
+  }
 
   /// \brief Returns the number of contact faces
   ///
@@ -353,30 +384,35 @@ class ContactManager
   ApplyDisplacements(const double* displacement);
 
   void
-  GetForces(double* contact_force) const;
+  AddForces(double* contact_force) const;
 
   void
-  ComputeContactForce(int step, bool debug_output)
+  ComputeContactForce()
   {
     if (penalty_parameter_ <= 0.0) {
       throw std::invalid_argument("\nError in ComputeContactForce(), invalid penalty_parameter.\n");
     }
-    double background_grid_cell_size = BoundingBoxAverageCharacteristicLengthOverAllRanks();
 #ifdef NIMBLE_HAVE_KOKKOS
-    contact_interface->ComputeContact(contact_nodes_d_, contact_faces_d_, force_d_);
+    contact_interface->ComputeContact(contact_nodes_d_, contact_faces_d_, force_d_, penalty_parameter_);
 #endif
   }
 
 #ifdef NIMBLE_HAVE_KOKKOS
-  // Kokkos versions of ApplyDisplacements and GetForces
+  // Kokkos versions of ApplyDisplacements and AddForces
   void
   ApplyDisplacements(nimble_kokkos::DeviceVectorNodeView displacement_d);
   void
-  GetForces(nimble_kokkos::DeviceVectorNodeView contact_force_d) const;
+  AddForces(nimble_kokkos::DeviceVectorNodeView contact_force_d) const;
 #endif
 
+  /// \brief Enforce every node-face pair whose bounding boxes intersect
+  ///
+  /// \param[in,out] nodes Contact nodes, flagged when in contact
+  /// \param[in,out] triangles Contact faces, flagged when in contact
+  ///
+  /// \note The force is added to force_.
   void
-  BruteForceBoxIntersectionSearch(std::vector<ContactEntity> const& nodes, std::vector<ContactEntity> const& triangles);
+  BruteForceBoxIntersectionSearch(std::vector<ContactEntity>& nodes, std::vector<ContactEntity>& triangles);
 
   void
   ClosestPointProjection(
@@ -512,9 +548,61 @@ class ContactManager
   std::shared_ptr<ContactInterface> contact_interface;
 };
 
+/// \brief Settings for one independent contact interaction of the input deck
+///
+/// Each "contact:" line defines one interaction with the syntax
+///   [name <label>] primary_blocks ... secondary_blocks ... penalty_parameter <value> [dicing <n>]
+struct ContactInteraction
+{
+  std::string              name;
+  std::vector<std::string> primary_block_names;
+  std::vector<std::string> secondary_block_names;
+  double                   penalty_parameter = 0.0;
+  int                      dicing            = 1;
+};
+
+/// \brief Parse one contact command into an interaction
+///
+/// \param command Value of a "contact:" line
+/// \param default_name Name used when the command does not specify one
+/// \param default_dicing Search dicing used when the command does not specify one
+ContactInteraction
+ParseContactInteraction(std::string const& command, std::string const& default_name, int default_dicing);
+
 std::shared_ptr<nimble::ContactManager>
 GetContactManager(std::shared_ptr<ContactInterface> interface, nimble::DataManager& data_manager);
 
+/// \brief Create a contact manager with its own search structure for one interaction
+std::shared_ptr<nimble::ContactManager>
+GetContactManager(
+    std::shared_ptr<ContactInterface> interface,
+    nimble::DataManager&              data_manager,
+    ContactInteraction const&         interaction);
+
+/// \brief Compute the contact force of every interaction and sum them into contact_force
+///
+/// \note Each manager runs its own search and enforcement pass; the interactions
+/// only meet in the combined nodal force.
+void
+ComputeContactForce(
+    std::vector<std::shared_ptr<nimble::ContactManager>> const& contact_managers,
+    nimble::Viewify<2>                                          contact_force);
+
+/// \brief Rank-local part of ComputeContactForce for every interaction
+///
+/// \note Requires HasLocalContactForce() for every manager; the summed force
+/// is completed with ReduceContactForce.
+void
+ComputeLocalContactForce(
+    std::vector<std::shared_ptr<nimble::ContactManager>> const& contact_managers,
+    nimble::Viewify<2>                                          contact_force);
+
+/// \brief Sum the rank-local contact force of every interaction over the ranks
+void
+ReduceContactForce(
+    std::vector<std::shared_ptr<nimble::ContactManager>> const& contact_managers,
+    nimble::Viewify<2>                                          contact_force);
+
 }  // namespace nimble
 
 #endif  // NIMBLE_MATERIAL_H
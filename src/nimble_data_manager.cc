@@ -138,7 +138,8 @@ DataManager::Initialize()
   // Initialize vectors for storing fields
   //
 
-  if (time_integration_scheme == "explicit")
+  if (time_integration_scheme == "explicit" || time_integration_scheme == "dynamic relaxation" ||
+      time_integration_scheme == "implicit dynamics")
     field_ids_.lumped_mass = model_data_->AllocateNodeData(nimble::SCALAR, "lumped_mass", num_nodes);
 
   field_ids_.reference_coordinates = model_data_->AllocateNodeData(nimble::VECTOR, "reference_coordinate", num_nodes);
@@ -151,9 +152,9 @@ DataManager::Initialize()
 
   field_ids_.contact_force = model_data_->AllocateNodeData(nimble::VECTOR, "contact_force", num_nodes);
 
-  if (time_integration_scheme == "quasistatic") {
+  if (time_integration_scheme == "quasistatic" || time_integration_scheme == "implicit dynamics") {
     //
-    // These variables are used in the "quasi-static" simulations
+    // These variables are used in the "quasi-static" and "implicit dynamics" simulations
     //
     model_data_->AllocateNodeData(nimble::VECTOR, "trial_displacement", num_nodes);
     model_data_->AllocateNodeData(nimble::VECTOR, "displacement_fluctuation", num_nodes);
@@ -55,4 +55,22 @@
 
 #endif
 
+//! Number of elements processed together by the batched host element kernels,
+//! batched data is stored element-minor, entry i of lane l at [i * NIMBLE_ELEMENT_BATCH_WIDTH + l]
+#ifndef NIMBLE_ELEMENT_BATCH_WIDTH
+#define NIMBLE_ELEMENT_BATCH_WIDTH 8
+#endif
+
+namespace nimble {
+
+//! Storage type of the integration point data (deformation gradient, stress
+//! and state variables), the element and material kernels compute in double
+#ifdef NIMBLE_SINGLE_PRECISION_STATE
+typedef float StateScalar;
+#else
+typedef double StateScalar;
+#endif
+
+}  // namespace nimble
+
 #endif  // NIMBLESM_NIMBLE_DEFS_H
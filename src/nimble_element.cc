@@ -43,12 +43,57 @@
 
 #include "nimble_element.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <limits>
+#include <vector>
 
 #include "nimble_utils.h"
 
 namespace nimble {
 
+namespace {
+
+//! Cofactor inverse of the 3x3 matrix stored in mat[3 * i + j][lane], returns the determinant
+inline double
+InvertBatchLane3x3(const double mat[][NIMBLE_ELEMENT_BATCH_WIDTH], int lane, double inv[][3])
+{
+  double minor0 = mat[4][lane] * mat[8][lane] - mat[5][lane] * mat[7][lane];
+  double minor1 = mat[3][lane] * mat[8][lane] - mat[5][lane] * mat[6][lane];
+  double minor2 = mat[3][lane] * mat[7][lane] - mat[4][lane] * mat[6][lane];
+  double minor3 = mat[1][lane] * mat[8][lane] - mat[2][lane] * mat[7][lane];
+  double minor4 = mat[0][lane] * mat[8][lane] - mat[6][lane] * mat[2][lane];
+  double minor5 = mat[0][lane] * mat[7][lane] - mat[1][lane] * mat[6][lane];
+  double minor6 = mat[1][lane] * mat[5][lane] - mat[2][lane] * mat[4][lane];
+  double minor7 = mat[0][lane] * mat[5][lane] - mat[2][lane] * mat[3][lane];
+  double minor8 = mat[0][lane] * mat[4][lane] - mat[1][lane] * mat[3][lane];
+  double det    = mat[0][lane] * minor0 - mat[1][lane] * minor1 + mat[2][lane] * minor2;
+
+  inv[0][0] = minor0 / det;
+  inv[0][1] = -1.0 * minor3 / det;
+  inv[0][2] = minor6 / det;
+  inv[1][0] = -1.0 * minor1 / det;
+  inv[1][1] = minor4 / det;
+  inv[1][2] = -1.0 * minor7 / det;
+  inv[2][0] = minor2 / det;
+  inv[2][1] = -1.0 * minor5 / det;
+  inv[2][2] = minor8 / det;
+
+  return det;
+}
+
+//! The determinant checks are kept out of the lane loops so that they vectorize
+inline void
+CheckBatchDeterminants(int num_lanes, const double* det)
+{
+  for (int lane = 0; lane < num_lanes; lane++) {
+    NIMBLE_ASSERT(det[lane] > 0.0, "\n**** Error in HexElement batched kernel, singular matrix.\n");
+  }
+}
+
+}  // namespace
+
 double
 Element::Invert3x3(double mat[][3], double inv[][3]) const
 {
@@ -247,6 +292,67 @@ Element::MatrixInverseCheckCorrectness(double mat[][3], double inv[][3]) const
   return forbenius_norm;
 }
 
+void
+Element::ComputeDeformationGradientsBatch(
+    int           num_lanes,
+    const double* node_reference_coords,
+    const double* node_current_coords,
+    double*       deformation_gradients)
+{
+  constexpr int width          = NIMBLE_ELEMENT_BATCH_WIDTH;
+  constexpr int max_node_data  = 3 * MaxElementTopology::num_nodes;
+  constexpr int max_def_grad   = 9 * MaxElementTopology::num_int_pts;
+  const int     node_data_size = Dim() * NumNodesPerElement();
+  const int     def_grad_size  = Dim() * Dim() * NumIntegrationPointsPerElement();
+  NIMBLE_ASSERT(
+      node_data_size <= max_node_data && def_grad_size <= max_def_grad,
+      "\n**** Error in Element::ComputeDeformationGradientsBatch(), element larger than MaxElementTopology.\n");
+
+  // One row per lane, filled by a single pass over the element-minor entries
+  double ref_coord[width][max_node_data], cur_coord[width][max_node_data], def_grad[width][max_def_grad];
+  for (int i = 0; i < node_data_size; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) {
+      ref_coord[lane][i] = node_reference_coords[i * width + lane];
+      cur_coord[lane][i] = node_current_coords[i * width + lane];
+    }
+  }
+  for (int lane = 0; lane < num_lanes; lane++) {
+    ComputeDeformationGradients(ref_coord[lane], cur_coord[lane], def_grad[lane]);
+  }
+  for (int i = 0; i < def_grad_size; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) { deformation_gradients[i * width + lane] = def_grad[lane][i]; }
+  }
+}
+
+void
+Element::ComputeNodalForcesBatch(
+    int           num_lanes,
+    const double* node_current_coords,
+    const double* int_pt_stresses,
+    double*       node_forces)
+{
+  constexpr int width          = NIMBLE_ELEMENT_BATCH_WIDTH;
+  constexpr int max_node_data  = 3 * MaxElementTopology::num_nodes;
+  constexpr int max_stress     = 6 * MaxElementTopology::num_int_pts;
+  const int     node_data_size = Dim() * NumNodesPerElement();
+  const int     stress_size    = (Dim() * (Dim() + 1) / 2) * NumIntegrationPointsPerElement();
+  NIMBLE_ASSERT(
+      node_data_size <= max_node_data && stress_size <= max_stress,
+      "\n**** Error in Element::ComputeNodalForcesBatch(), element larger than MaxElementTopology.\n");
+
+  double cur_coord[width][max_node_data], stress[width][max_stress], force[width][max_node_data];
+  for (int i = 0; i < node_data_size; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) { cur_coord[lane][i] = node_current_coords[i * width + lane]; }
+  }
+  for (int i = 0; i < stress_size; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) { stress[lane][i] = int_pt_stresses[i * width + lane]; }
+  }
+  for (int lane = 0; lane < num_lanes; lane++) { ComputeNodalForces(cur_coord[lane], stress[lane], force[lane]); }
+  for (int i = 0; i < node_data_size; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) { node_forces[i * width + lane] = force[lane][i]; }
+  }
+}
+
 HexElement::HexElement()
 {
   // 1/sqrt(3)
@@ -484,6 +590,28 @@ HexElement::ComputeLumpedMass(
 
 double
 HexElement::ComputeCharacteristicLength(const double* node_coords)
+{
+  return CharacteristicLengthKernel(node_coords);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+double
+HexElement::ComputeCharacteristicLength(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements) const
+{
+  double cur_coord[num_nodes_ * dim_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  return CharacteristicLengthKernel(cur_coord);
+}
+#endif
+
+double
+HexElement::CharacteristicLengthKernel(const double* node_coords) const
 {
   // TODO Implement a better algorithm for finding the minimum
   //      length across the element.
@@ -492,7 +620,7 @@ HexElement::ComputeCharacteristicLength(const double* node_coords)
   double x_min, x_max, y_min, y_max, z_min, z_max;
 
   x_max = y_max = z_max = 0.0;
-  min_distance_squared = x_min = y_min = z_min = std::numeric_limits<double>::max();
+  min_distance_squared = x_min = y_min = z_min = DBL_MAX;
 
   for (int n = 0; n < num_nodes_; n++) {
     nx = node_coords[3 * n];
@@ -512,7 +640,7 @@ HexElement::ComputeCharacteristicLength(const double* node_coords)
       if (distance_squared < min_distance_squared) { min_distance_squared = distance_squared; }
     }
   }
-  characteristic_length = std::sqrt(min_distance_squared);
+  characteristic_length = sqrt(min_distance_squared);
 
   double min_box_length = x_max - x_min;
   if (y_max - y_min < min_box_length) { min_box_length = y_max - y_min; }
@@ -1115,4 +1243,1254 @@ HexElement::ComputeNodalForces(
 }
 #endif
 
+void
+HexElement::ComputeDeformationGradientsBatch(
+    int           num_lanes,
+    const double* node_reference_coords,
+    const double* node_current_coords,
+    double*       deformation_gradients)
+{
+  constexpr int width = NIMBLE_ELEMENT_BATCH_WIDTH;
+
+  // a and b hold entry (i, j) of each lane at [3 * i + j][lane]
+  double a[9][width], b[9][width], det[width];
+
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    const double* sfd = &shape_fcn_deriv_[24 * int_pt];
+
+    for (int k = 0; k < 9; k++) {
+      for (int lane = 0; lane < num_lanes; lane++) {
+        a[k][lane] = 0.0;
+        b[k][lane] = 0.0;
+      }
+    }
+
+    // \sum_{i}^{N_{node}} x_{i} \frac{\partial N_{i} (\xi)}{\partial \xi} and the same for X_{i}
+    for (int n = 0; n < num_nodes_; n++) {
+      for (int i = 0; i < dim_; i++) {
+        const double* cc = &node_current_coords[(dim_ * n + i) * width];
+        const double* rc = &node_reference_coords[(dim_ * n + i) * width];
+        for (int j = 0; j < dim_; j++) {
+          const double sfd_j = sfd[dim_ * n + j];
+          for (int lane = 0; lane < num_lanes; lane++) {
+            a[3 * i + j][lane] += cc[lane] * sfd_j;
+            b[3 * i + j][lane] += rc[lane] * sfd_j;
+          }
+        }
+      }
+    }
+
+    double* def_grad = &deformation_gradients[9 * int_pt * width];
+    for (int lane = 0; lane < num_lanes; lane++) {
+      double b_inv[3][3], f[3][3];
+      det[lane] = InvertBatchLane3x3(b, lane, b_inv);
+      for (int j = 0; j < 3; j++) {
+        for (int k = 0; k < 3; k++) {
+          f[j][k] = a[3 * j][lane] * b_inv[0][k] + a[3 * j + 1][lane] * b_inv[1][k] + a[3 * j + 2][lane] * b_inv[2][k];
+        }
+      }
+      def_grad[K_F_XX * width + lane] = f[0][0];
+      def_grad[K_F_XY * width + lane] = f[0][1];
+      def_grad[K_F_XZ * width + lane] = f[0][2];
+      def_grad[K_F_YX * width + lane] = f[1][0];
+      def_grad[K_F_YY * width + lane] = f[1][1];
+      def_grad[K_F_YZ * width + lane] = f[1][2];
+      def_grad[K_F_ZX * width + lane] = f[2][0];
+      def_grad[K_F_ZY * width + lane] = f[2][1];
+      def_grad[K_F_ZZ * width + lane] = f[2][2];
+    }
+    CheckBatchDeterminants(num_lanes, det);
+  }
+}
+
+void
+HexElement::ComputeNodalForcesBatch(
+    int           num_lanes,
+    const double* node_current_coords,
+    const double* int_pt_stresses,
+    double*       node_forces)
+{
+  constexpr int width           = NIMBLE_ELEMENT_BATCH_WIDTH;
+  constexpr int sym_tensor_size = 6;
+
+  // a and a_inv hold entry (i, j) of each lane at [3 * i + j][lane]
+  double a[9][width], a_inv[9][width], weight[width], det[width];
+
+  for (int k = 0; k < num_nodes_ * dim_; k++) {
+    for (int lane = 0; lane < num_lanes; lane++) { node_forces[k * width + lane] = 0.0; }
+  }
+
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    const double* sfd = &shape_fcn_deriv_[24 * int_pt];
+
+    for (int k = 0; k < 9; k++) {
+      for (int lane = 0; lane < num_lanes; lane++) { a[k][lane] = 0.0; }
+    }
+
+    // \sum_{i}^{N_{node}} x_{i} \frac{\partial N_{i} (\xi)}{\partial \xi}
+    for (int n = 0; n < num_nodes_; n++) {
+      for (int i = 0; i < dim_; i++) {
+        const double* cc = &node_current_coords[(dim_ * n + i) * width];
+        for (int j = 0; j < dim_; j++) {
+          const double sfd_j = sfd[dim_ * n + j];
+          for (int lane = 0; lane < num_lanes; lane++) { a[3 * i + j][lane] += cc[lane] * sfd_j; }
+        }
+      }
+    }
+
+    for (int lane = 0; lane < num_lanes; lane++) {
+      double inv[3][3];
+      det[lane]    = InvertBatchLane3x3(a, lane, inv);
+      weight[lane] = det[lane] * int_wts_[int_pt];
+      for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) { a_inv[3 * i + j][lane] = inv[i][j]; }
+      }
+    }
+    CheckBatchDeterminants(num_lanes, det);
+
+    const double* sig = &int_pt_stresses[sym_tensor_size * int_pt * width];
+    for (int node = 0; node < num_nodes_; node++) {
+      const double sfd1 = sfd[dim_ * node];
+      const double sfd2 = sfd[dim_ * node + 1];
+      const double sfd3 = sfd[dim_ * node + 2];
+      double*      f1   = &node_forces[(dim_ * node) * width];
+      double*      f2   = &node_forces[(dim_ * node + 1) * width];
+      double*      f3   = &node_forces[(dim_ * node + 2) * width];
+      for (int lane = 0; lane < num_lanes; lane++) {
+        double dN_dx1 = sfd1 * a_inv[0][lane] + sfd2 * a_inv[3][lane] + sfd3 * a_inv[6][lane];
+        double dN_dx2 = sfd1 * a_inv[1][lane] + sfd2 * a_inv[4][lane] + sfd3 * a_inv[7][lane];
+        double dN_dx3 = sfd1 * a_inv[2][lane] + sfd2 * a_inv[5][lane] + sfd3 * a_inv[8][lane];
+
+        f1[lane] -= weight[lane] * (dN_dx1 * sig[K_S_XX * width + lane] + dN_dx2 * sig[K_S_YX * width + lane] +
+                                    dN_dx3 * sig[K_S_ZX * width + lane]);
+        f2[lane] -= weight[lane] * (dN_dx1 * sig[K_S_XY * width + lane] + dN_dx2 * sig[K_S_YY * width + lane] +
+                                    dN_dx3 * sig[K_S_ZY * width + lane]);
+        f3[lane] -= weight[lane] * (dN_dx1 * sig[K_S_XZ * width + lane] + dN_dx2 * sig[K_S_YZ * width + lane] +
+                                    dN_dx3 * sig[K_S_ZZ * width + lane]);
+      }
+    }
+  }
+}
+
+//
+// Topology specializations, these must precede the generic SolidElement members
+//
+
+template <>
+void
+SolidElement<Tet4Topology>::IntegrationRule(double* natural_coords, double* weights)
+{
+  for (int i = 0; i < 3; i++) { natural_coords[i] = 0.25; }
+  weights[0] = 1.0 / 6.0;
+}
+
+template <>
+void
+SolidElement<Tet4Topology>::ShapeFunctionValues(const double* natural_coords, double* shape_function_values)
+{
+  double r = natural_coords[0];
+  double s = natural_coords[1];
+  double t = natural_coords[2];
+
+  shape_function_values[0] = 1.0 - r - s - t;
+  shape_function_values[1] = r;
+  shape_function_values[2] = s;
+  shape_function_values[3] = t;
+}
+
+template <>
+void
+SolidElement<Tet4Topology>::ShapeFunctionDerivatives(
+    const double* /* natural_coords */,
+    double*       shape_function_derivatives)
+{
+  // Constant for the linear tetrahedron
+  const double derivatives[] = {-1.0, -1.0, -1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  for (int i = 0; i < 12; i++) { shape_function_derivatives[i] = derivatives[i]; }
+}
+
+template <>
+void
+SolidElement<Tet10Topology>::IntegrationRule(double* natural_coords, double* weights)
+{
+  // Four point rule, exact for quadratics
+  const double a = 0.585410196624969;
+  const double b = 0.138196601125011;
+  for (int int_pt = 0; int_pt < 4; int_pt++) {
+    for (int i = 0; i < 3; i++) { natural_coords[3 * int_pt + i] = (int_pt == i + 1) ? a : b; }
+    weights[int_pt] = 1.0 / 24.0;
+  }
+}
+
+template <>
+void
+SolidElement<Tet10Topology>::ShapeFunctionValues(const double* natural_coords, double* shape_function_values)
+{
+  double r = natural_coords[0];
+  double s = natural_coords[1];
+  double t = natural_coords[2];
+  double u = 1.0 - r - s - t;
+
+  // vertices
+  shape_function_values[0] = u * (2.0 * u - 1.0);
+  shape_function_values[1] = r * (2.0 * r - 1.0);
+  shape_function_values[2] = s * (2.0 * s - 1.0);
+  shape_function_values[3] = t * (2.0 * t - 1.0);
+  // edges 0-1, 1-2, 2-0, 0-3, 1-3, 2-3
+  shape_function_values[4] = 4.0 * u * r;
+  shape_function_values[5] = 4.0 * r * s;
+  shape_function_values[6] = 4.0 * s * u;
+  shape_function_values[7] = 4.0 * u * t;
+  shape_function_values[8] = 4.0 * r * t;
+  shape_function_values[9] = 4.0 * s * t;
+}
+
+template <>
+void
+SolidElement<Tet10Topology>::ShapeFunctionDerivatives(const double* natural_coords, double* shape_function_derivatives)
+{
+  double  r  = natural_coords[0];
+  double  s  = natural_coords[1];
+  double  t  = natural_coords[2];
+  double  u  = 1.0 - r - s - t;
+  double* sd = shape_function_derivatives;
+
+  // vertices
+  sd[0]  = sd[1] = sd[2] = 1.0 - 4.0 * u;
+  sd[3]  = 4.0 * r - 1.0;
+  sd[4]  = 0.0;
+  sd[5]  = 0.0;
+  sd[6]  = 0.0;
+  sd[7]  = 4.0 * s - 1.0;
+  sd[8]  = 0.0;
+  sd[9]  = 0.0;
+  sd[10] = 0.0;
+  sd[11] = 4.0 * t - 1.0;
+  // edge 0-1
+  sd[12] = 4.0 * (u - r);
+  sd[13] = -4.0 * r;
+  sd[14] = -4.0 * r;
+  // edge 1-2
+  sd[15] = 4.0 * s;
+  sd[16] = 4.0 * r;
+  sd[17] = 0.0;
+  // edge 2-0
+  sd[18] = -4.0 * s;
+  sd[19] = 4.0 * (u - s);
+  sd[20] = -4.0 * s;
+  // edge 0-3
+  sd[21] = -4.0 * t;
+  sd[22] = -4.0 * t;
+  sd[23] = 4.0 * (u - t);
+  // edge 1-3
+  sd[24] = 4.0 * t;
+  sd[25] = 0.0;
+  sd[26] = 4.0 * r;
+  // edge 2-3
+  sd[27] = 0.0;
+  sd[28] = 4.0 * t;
+  sd[29] = 4.0 * s;
+}
+
+//
+// SolidElement
+//
+
+template <typename Topology>
+SolidElement<Topology>::SolidElement()
+{
+  IntegrationRule(int_pts_, int_wts_);
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    ShapeFunctionValues(&int_pts_[dim_ * int_pt], &shape_fcn_vals_[num_nodes_ * int_pt]);
+    ShapeFunctionDerivatives(&int_pts_[dim_ * int_pt], &shape_fcn_deriv_[num_nodes_ * dim_ * int_pt]);
+  }
+}
+
+template <typename Topology>
+double
+SolidElement<Topology>::ShapeFunctionGradients(int int_pt, const double* node_coords, double* shape_fcn_grad) const
+{
+  const double* sfd = &shape_fcn_deriv_[num_nodes_ * dim_ * int_pt];
+
+  // \sum_{i}^{N_{node}} x_{i} \frac{\partial N_{i} (\xi)}{\partial \xi}
+  double a[][3]     = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+  double a_inv[][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      for (int j = 0; j < dim_; j++) { a[i][j] += node_coords[dim_ * n + i] * sfd[dim_ * n + j]; }
+    }
+  }
+
+  double jac_det = Invert3x3(a, a_inv);
+
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int j = 0; j < dim_; j++) {
+      shape_fcn_grad[dim_ * n + j] =
+          sfd[dim_ * n] * a_inv[0][j] + sfd[dim_ * n + 1] * a_inv[1][j] + sfd[dim_ * n + 2] * a_inv[2][j];
+    }
+  }
+
+  return jac_det;
+}
+
+template <typename Topology>
+void
+SolidElement<Topology>::LumpedMassKernel(
+    const double  density,
+    const double* node_reference_coords,
+    double*       lumped_mass) const
+{
+  double shape_fcn_grad[num_nodes_ * dim_];
+  double total_mass = 0.0;
+  double diagonal_sum = 0.0;
+
+  for (int i = 0; i < num_nodes_; i++) { lumped_mass[i] = 0.0; }
+
+  // Diagonal of the consistent mass matrix
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    double jac_det = ShapeFunctionGradients(int_pt, node_reference_coords, shape_fcn_grad);
+    double weight  = int_wts_[int_pt] * density * jac_det;
+    total_mass += weight;
+    for (int i = 0; i < num_nodes_; i++) {
+      double sfv = shape_fcn_vals_[int_pt * num_nodes_ + i];
+      lumped_mass[i] += weight * sfv * sfv;
+    }
+  }
+
+  // HRZ lumping, scale the diagonal to the element mass
+  for (int i = 0; i < num_nodes_; i++) { diagonal_sum += lumped_mass[i]; }
+  for (int i = 0; i < num_nodes_; i++) { lumped_mass[i] *= total_mass / diagonal_sum; }
+}
+
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeLumpedMass(
+    const double  density,
+    const double* node_reference_coords,
+    double*       lumped_mass) const
+{
+  LumpedMassKernel(density, node_reference_coords, lumped_mass);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeLumpedMass(
+    const double                                   density,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceScalarNodeGatheredSubView lumped_mass) const
+{
+  double ref_coord[num_nodes_ * dim_];
+  double mass[num_nodes_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) { ref_coord[dim_ * n + i] = node_reference_coords(n, i); }
+  }
+  LumpedMassKernel(density, ref_coord, mass);
+  for (int n = 0; n < num_nodes_; n++) { lumped_mass(n) = mass[n]; }
+}
+#endif
+
+template <typename Topology>
+double
+SolidElement<Topology>::ComputeCharacteristicLength(const double* node_coords)
+{
+  return CharacteristicLengthKernel(node_coords);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+template <typename Topology>
+double
+SolidElement<Topology>::ComputeCharacteristicLength(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements) const
+{
+  double cur_coord[num_nodes_ * dim_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  return CharacteristicLengthKernel(cur_coord);
+}
+#endif
+
+template <typename Topology>
+double
+SolidElement<Topology>::CharacteristicLengthKernel(const double* node_coords) const
+{
+  // Vertex altitudes are 3 V / A_face, the smallest uses the largest face
+  const int faces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+
+  double edge[3][3];
+  for (int k = 0; k < 3; k++) {
+    for (int i = 0; i < 3; i++) { edge[k][i] = node_coords[3 * (k + 1) + i] - node_coords[i]; }
+  }
+  double six_volume = fabs(
+      edge[0][0] * (edge[1][1] * edge[2][2] - edge[1][2] * edge[2][1]) -
+      edge[0][1] * (edge[1][0] * edge[2][2] - edge[1][2] * edge[2][0]) +
+      edge[0][2] * (edge[1][0] * edge[2][1] - edge[1][1] * edge[2][0]));
+
+  double max_twice_area = 0.0;
+  for (int f = 0; f < 4; f++) {
+    const double* p0 = &node_coords[3 * faces[f][0]];
+    const double* p1 = &node_coords[3 * faces[f][1]];
+    const double* p2 = &node_coords[3 * faces[f][2]];
+    double        u[] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+    double        v[] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+    double        cx  = u[1] * v[2] - u[2] * v[1];
+    double        cy  = u[2] * v[0] - u[0] * v[2];
+    double        cz  = u[0] * v[1] - u[1] * v[0];
+
+    double twice_area = sqrt(cx * cx + cy * cy + cz * cz);
+    if (twice_area > max_twice_area) { max_twice_area = twice_area; }
+  }
+
+  // 3 V / A = (6 V) / (2 A)
+  return six_volume / max_twice_area / Topology::order;
+}
+
+template <typename Topology>
+double
+SolidElement<Topology>::VolumeAverageKernel(
+    const double* node_current_coords,
+    int           num_quantities,
+    const double* int_pt_quantities,
+    double*       volume_averaged_quantities) const
+{
+  double shape_fcn_grad[num_nodes_ * dim_];
+  double volume = 0.0;
+
+  for (int i_quantity = 0; i_quantity < num_quantities; i_quantity++) { volume_averaged_quantities[i_quantity] = 0.0; }
+
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    double weight = int_wts_[int_pt] * ShapeFunctionGradients(int_pt, node_current_coords, shape_fcn_grad);
+    volume += weight;
+    for (int i_quantity = 0; i_quantity < num_quantities; i_quantity++) {
+      volume_averaged_quantities[i_quantity] += int_pt_quantities[int_pt * num_quantities + i_quantity] * weight;
+    }
+  }
+
+  for (int i_quantity = 0; i_quantity < num_quantities; i_quantity++) {
+    volume_averaged_quantities[i_quantity] /= volume;
+  }
+
+  return volume;
+}
+
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeVolumeAverage(
+    const double* node_current_coords,
+    int           num_quantities,
+    const double* int_pt_quantities,
+    double&       volume,
+    double*       volume_averaged_quantities) const
+{
+  volume = VolumeAverageKernel(node_current_coords, num_quantities, int_pt_quantities, volume_averaged_quantities);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeVolume(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+    nimble_kokkos::DeviceScalarElemSingleEntryView elem_volume) const
+{
+  double cur_coord[num_nodes_ * dim_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+
+  // See HexElement::ComputeVolume() regarding the raw pointer
+  double* v = elem_volume.data();
+  *v        = VolumeAverageKernel(cur_coord, 0, nullptr, nullptr);
+}
+
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeVolumeAverageSymTensor(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView    node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView    node_displacements,
+    nimble_kokkos::DeviceSymTensorIntPtSubView        int_pt_quantities,
+    nimble_kokkos::DeviceSymTensorElemSingleEntryView vol_ave_quantity) const
+{
+  const int num_quantities = 6;
+  double    cur_coord[num_nodes_ * dim_];
+  double    quantities[num_int_pts_ * num_quantities];
+  double    vol_ave[num_quantities];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    for (int i = 0; i < num_quantities; i++) { quantities[int_pt * num_quantities + i] = int_pt_quantities(int_pt, i); }
+  }
+  VolumeAverageKernel(cur_coord, num_quantities, quantities, vol_ave);
+  for (int i = 0; i < num_quantities; i++) { vol_ave_quantity(i) = vol_ave[i]; }
+}
+
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeVolumeAverageFullTensor(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView     node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView     node_displacements,
+    nimble_kokkos::DeviceFullTensorIntPtSubView        int_pt_quantities,
+    nimble_kokkos::DeviceFullTensorElemSingleEntryView vol_ave_quantity) const
+{
+  const int num_quantities = 9;
+  double    cur_coord[num_nodes_ * dim_];
+  double    quantities[num_int_pts_ * num_quantities];
+  double    vol_ave[num_quantities];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    for (int i = 0; i < num_quantities; i++) { quantities[int_pt * num_quantities + i] = int_pt_quantities(int_pt, i); }
+  }
+  VolumeAverageKernel(cur_coord, num_quantities, quantities, vol_ave);
+  for (int i = 0; i < num_quantities; i++) { vol_ave_quantity(i) = vol_ave[i]; }
+}
+#endif
+
+template <typename Topology>
+void
+SolidElement<Topology>::DeformationGradientsKernel(
+    const double* node_reference_coords,
+    const double* node_current_coords,
+    double*       deformation_gradients) const
+{
+  const int full_tensor_index[3][3] = {{K_F_XX, K_F_XY, K_F_XZ}, {K_F_YX, K_F_YY, K_F_YZ}, {K_F_ZX, K_F_ZY, K_F_ZZ}};
+  double    shape_fcn_grad[num_nodes_ * dim_];
+
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    // F = \sum_{i}^{N_{node}} x_{i} \otimes \frac{\partial N_{i}}{\partial X}
+    ShapeFunctionGradients(int_pt, node_reference_coords, shape_fcn_grad);
+    for (int j = 0; j < dim_; j++) {
+      for (int k = 0; k < dim_; k++) {
+        double def_grad = 0.0;
+        for (int n = 0; n < num_nodes_; n++) {
+          def_grad += node_current_coords[dim_ * n + j] * shape_fcn_grad[dim_ * n + k];
+        }
+        deformation_gradients[9 * int_pt + full_tensor_index[j][k]] = def_grad;
+      }
+    }
+  }
+}
+
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeDeformationGradients(
+    const double* node_reference_coords,
+    const double* node_current_coords,
+    double*       deformation_gradients) const
+{
+  DeformationGradientsKernel(node_reference_coords, node_current_coords, deformation_gradients);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeDeformationGradients(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+    nimble_kokkos::DeviceFullTensorIntPtSubView    deformation_gradients) const
+{
+  double ref_coord[num_nodes_ * dim_];
+  double cur_coord[num_nodes_ * dim_];
+  double def_grad[num_int_pts_ * 9];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      ref_coord[dim_ * n + i] = node_reference_coords(n, i);
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  DeformationGradientsKernel(ref_coord, cur_coord, def_grad);
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    for (int i = 0; i < 9; i++) { deformation_gradients(int_pt, i) = def_grad[9 * int_pt + i]; }
+  }
+}
+#endif
+
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeTangent(
+    const double* node_current_coords,
+    const double* material_tangent,
+    double*       element_tangent)
+{
+  constexpr int num_dof = num_nodes_ * dim_;
+  double        shape_fcn_grad[num_nodes_ * dim_];
+  double        B[6][num_dof];
+  double        temp[6][num_dof];
+
+  for (int i = 0; i < num_dof * num_dof; i++) { element_tangent[i] = 0.0; }
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < num_dof; j++) { B[i][j] = 0.0; }
+  }
+
+  // \mathbf{K}_{elem} = \int \mathbf{B}^{T} \mathbf{C} \mathbf{B} d\Omega, see HexElement::ComputeTangent()
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    double jac_det = ShapeFunctionGradients(int_pt, node_current_coords, shape_fcn_grad);
+
+    for (int n = 0; n < num_nodes_; n++) {
+      double dN_dcc1  = shape_fcn_grad[3 * n];
+      double dN_dcc2  = shape_fcn_grad[3 * n + 1];
+      double dN_dcc3  = shape_fcn_grad[3 * n + 2];
+      B[0][3 * n]     = dN_dcc1;
+      B[1][3 * n + 1] = dN_dcc2;
+      B[2][3 * n + 2] = dN_dcc3;
+      B[3][3 * n]     = dN_dcc2;
+      B[3][3 * n + 1] = dN_dcc1;
+      B[4][3 * n + 1] = dN_dcc3;
+      B[4][3 * n + 2] = dN_dcc2;
+      B[5][3 * n]     = dN_dcc3;
+      B[5][3 * n + 2] = dN_dcc1;
+    }
+
+    for (int i = 0; i < 6; i++) {
+      for (int j = 0; j < num_dof; j++) {
+        temp[i][j] = 0.0;
+        for (int k = 0; k < 6; k++) { temp[i][j] += material_tangent[36 * int_pt + 6 * i + k] * B[k][j]; }
+      }
+    }
+
+    for (int i = 0; i < num_dof; i++) {
+      for (int j = 0; j < num_dof; j++) {
+        for (int k = 0; k < 6; k++) {
+          element_tangent[i * num_dof + j] += B[k][i] * temp[k][j] * int_wts_[int_pt] * jac_det;
+        }
+      }
+    }
+  }
+}
+
+template <typename Topology>
+void
+SolidElement<Topology>::NodalForcesKernel(
+    const double* node_current_coords,
+    const double* int_pt_stresses,
+    double*       node_forces) const
+{
+  const int sym_tensor_index[3][3] = {{K_S_XX, K_S_XY, K_S_XZ}, {K_S_YX, K_S_YY, K_S_YZ}, {K_S_ZX, K_S_ZY, K_S_ZZ}};
+  const int sym_tensor_size        = 6;
+  double    shape_fcn_grad[num_nodes_ * dim_];
+
+  for (int i = 0; i < num_nodes_ * dim_; i++) { node_forces[i] = 0.0; }
+
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    double        weight = int_wts_[int_pt] * ShapeFunctionGradients(int_pt, node_current_coords, shape_fcn_grad);
+    const double* sig    = &int_pt_stresses[sym_tensor_size * int_pt];
+    for (int n = 0; n < num_nodes_; n++) {
+      for (int i = 0; i < dim_; i++) {
+        double f = 0.0;
+        for (int j = 0; j < dim_; j++) { f += shape_fcn_grad[dim_ * n + j] * sig[sym_tensor_index[j][i]]; }
+        node_forces[dim_ * n + i] -= weight * f;
+      }
+    }
+  }
+}
+
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeNodalForces(
+    const double* node_current_coords,
+    const double* int_pt_stresses,
+    double*       node_forces)
+{
+  NodalForcesKernel(node_current_coords, int_pt_stresses, node_forces);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+template <typename Topology>
+void
+SolidElement<Topology>::ComputeNodalForces(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+    nimble_kokkos::DeviceSymTensorIntPtSubView     int_pt_stresses,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_forces) const
+{
+  double cur_coord[num_nodes_ * dim_];
+  double stress[num_int_pts_ * 6];
+  double force[num_nodes_ * dim_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    for (int i = 0; i < 6; i++) { stress[6 * int_pt + i] = int_pt_stresses(int_pt, i); }
+  }
+  NodalForcesKernel(cur_coord, stress, force);
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) { node_forces(n, i) = force[dim_ * n + i]; }
+  }
+}
+#endif
+
+template class SolidElement<Tet4Topology>;
+template class SolidElement<Tet10Topology>;
+
+//
+// CompositeTet10Element
+//
+
+int
+CompositeTet10Element::SubTetNode(int sub_tet, int i) const
+{
+  // Corner sub-tetrahedra, then the octahedron split around the center node,
+  // all with the orientation of the parent element
+  const int sub_tet_nodes[num_sub_tets_][4] = {
+      {0, 4, 6, 7},
+      {4, 1, 5, 8},
+      {6, 5, 2, 9},
+      {7, 8, 9, 3},
+      {4, 6, 7, 10},
+      {4, 8, 5, 10},
+      {6, 5, 9, 10},
+      {7, 9, 8, 10},
+      {4, 5, 6, 10},
+      {4, 7, 8, 10},
+      {5, 8, 9, 10},
+      {6, 9, 7, 10}};
+  return sub_tet_nodes[sub_tet][i];
+}
+
+void
+CompositeTet10Element::ExtendedCoordinates(const double* node_coords, double* extended_coords) const
+{
+  for (int i = 0; i < num_nodes_ * dim_; i++) { extended_coords[i] = node_coords[i]; }
+  for (int i = 0; i < dim_; i++) {
+    double center = 0.0;
+    for (int n = 4; n < num_nodes_; n++) { center += node_coords[dim_ * n + i]; }
+    extended_coords[dim_ * num_nodes_ + i] = center / 6.0;
+  }
+}
+
+double
+CompositeTet10Element::SubTetKernel(const double* node_coords, double* sub_tet_volumes, double* sub_tet_grads) const
+{
+  double x[(num_nodes_ + 1) * dim_];
+  double volume = 0.0;
+
+  ExtendedCoordinates(node_coords, x);
+
+  for (int s = 0; s < num_sub_tets_; s++) {
+    // a[i][j] = \frac{\partial x_{i}}{\partial \xi_{j}} for the linear map of the sub-tetrahedron
+    double        a[3][3];
+    double        a_inv[3][3];
+    const double* x0 = &x[dim_ * SubTetNode(s, 0)];
+    for (int j = 0; j < dim_; j++) {
+      const double* xj = &x[dim_ * SubTetNode(s, j + 1)];
+      for (int i = 0; i < dim_; i++) { a[i][j] = xj[i] - x0[i]; }
+    }
+    double jac_det     = Invert3x3(a, a_inv);
+    sub_tet_volumes[s] = jac_det / 6.0;
+    volume += sub_tet_volumes[s];
+
+    double* grad = &sub_tet_grads[4 * dim_ * s];
+    for (int k = 0; k < dim_; k++) {
+      grad[k] = -(a_inv[0][k] + a_inv[1][k] + a_inv[2][k]);
+      for (int j = 0; j < dim_; j++) { grad[dim_ * (j + 1) + k] = a_inv[j][k]; }
+    }
+  }
+
+  return volume;
+}
+
+double
+CompositeTet10Element::ProjectedGradientsKernel(const double* node_coords, double* proj_grad) const
+{
+  constexpr int num_vertices = Tet10Topology::num_vertices;
+  const int     edges[6][2]  = {{0, 1}, {1, 2}, {2, 0}, {0, 3}, {1, 3}, {2, 3}};
+
+  double sub_tet_volumes[num_sub_tets_];
+  double sub_tet_grads[num_sub_tets_ * 4 * dim_];
+  double volume = SubTetKernel(node_coords, sub_tet_volumes, sub_tet_grads);
+
+  // Barycentric coordinates of the parent element at the nodes and at the center node
+  double lambda[num_nodes_ + 1][num_vertices];
+  for (int n = 0; n <= num_nodes_; n++) {
+    for (int a = 0; a < num_vertices; a++) { lambda[n][a] = 0.0; }
+  }
+  for (int a = 0; a < num_vertices; a++) {
+    lambda[a][a]          = 1.0;
+    lambda[num_nodes_][a] = 0.25;
+  }
+  for (int e = 0; e < 6; e++) {
+    lambda[num_vertices + e][edges[e][0]] = 0.5;
+    lambda[num_vertices + e][edges[e][1]] = 0.5;
+  }
+
+  // L2 projection of the sub-tetrahedron gradients onto the linear functions \lambda_{a}:
+  // \sum_{b} M_{ab} \bar{G}_{b} = \sum_{s} \int_{T_{s}} \lambda_{a} dV \, G_{s}
+  double mass[num_vertices][num_vertices];
+  double mass_inv[num_vertices][num_vertices];
+  double rhs[num_vertices][num_nodes_ * dim_];
+  for (int a = 0; a < num_vertices; a++) {
+    for (int b = 0; b < num_vertices; b++) {
+      mass[a][b]     = 0.0;
+      mass_inv[a][b] = (a == b) ? 1.0 : 0.0;
+    }
+    for (int i = 0; i < num_nodes_ * dim_; i++) { rhs[a][i] = 0.0; }
+  }
+
+  for (int s = 0; s < num_sub_tets_; s++) {
+    const double volume_s = sub_tet_volumes[s];
+    int          nodes[4];
+    for (int i = 0; i < 4; i++) { nodes[i] = SubTetNode(s, i); }
+
+    // \int_{T_{s}} \lambda_{a} \lambda_{b} dV = \frac{V_{s}}{20} (S_{a} S_{b} + \sum_{i} \lambda_{a}(x_{i}) \lambda_{b}(x_{i})),
+    // with S_{a} = \sum_{i} \lambda_{a}(x_{i}) over the sub-tetrahedron nodes
+    double lambda_sum[num_vertices];
+    for (int a = 0; a < num_vertices; a++) {
+      lambda_sum[a] = 0.0;
+      for (int i = 0; i < 4; i++) { lambda_sum[a] += lambda[nodes[i]][a]; }
+    }
+    for (int a = 0; a < num_vertices; a++) {
+      for (int b = 0; b < num_vertices; b++) {
+        double product = lambda_sum[a] * lambda_sum[b];
+        for (int i = 0; i < 4; i++) { product += lambda[nodes[i]][a] * lambda[nodes[i]][b]; }
+        mass[a][b] += volume_s / 20.0 * product;
+      }
+    }
+
+    for (int i = 0; i < 4; i++) {
+      const double* grad = &sub_tet_grads[(4 * s + i) * dim_];
+      if (nodes[i] < num_nodes_) {
+        for (int a = 0; a < num_vertices; a++) {
+          const double integral = lambda_sum[a] * volume_s / 4.0;
+          for (int k = 0; k < dim_; k++) { rhs[a][dim_ * nodes[i] + k] += integral * grad[k]; }
+        }
+      } else {
+        // The center node is the average of the mid-edge nodes
+        for (int a = 0; a < num_vertices; a++) {
+          const double integral = lambda_sum[a] * volume_s / 24.0;
+          for (int m = num_vertices; m < num_nodes_; m++) {
+            for (int k = 0; k < dim_; k++) { rhs[a][dim_ * m + k] += integral * grad[k]; }
+          }
+        }
+      }
+    }
+  }
+
+  // Gauss-Jordan elimination, the mass matrix is symmetric positive definite
+  for (int p = 0; p < num_vertices; p++) {
+    const double pivot = 1.0 / mass[p][p];
+    for (int j = 0; j < num_vertices; j++) {
+      mass[p][j] *= pivot;
+      mass_inv[p][j] *= pivot;
+    }
+    for (int r = 0; r < num_vertices; r++) {
+      if (r == p) continue;
+      const double factor = mass[r][p];
+      for (int j = 0; j < num_vertices; j++) {
+        mass[r][j] -= factor * mass[p][j];
+        mass_inv[r][j] -= factor * mass_inv[p][j];
+      }
+    }
+  }
+
+  // Evaluate the projected field at the integration points of Tet10Topology
+  const double alpha = 0.585410196624969;
+  const double beta  = 0.138196601125011;
+  for (int q = 0; q < num_int_pts_; q++) {
+    double weight[num_vertices];
+    for (int b = 0; b < num_vertices; b++) {
+      weight[b] = 0.0;
+      for (int a = 0; a < num_vertices; a++) { weight[b] += ((a == q) ? alpha : beta) * mass_inv[a][b]; }
+    }
+    for (int i = 0; i < num_nodes_ * dim_; i++) {
+      double g = 0.0;
+      for (int b = 0; b < num_vertices; b++) { g += weight[b] * rhs[b][i]; }
+      proj_grad[num_nodes_ * dim_ * q + i] = g;
+    }
+  }
+
+  return volume;
+}
+
+void
+CompositeTet10Element::LumpedMassKernel(
+    const double  density,
+    const double* node_reference_coords,
+    double*       lumped_mass) const
+{
+  double sub_tet_volumes[num_sub_tets_];
+  double sub_tet_grads[num_sub_tets_ * 4 * dim_];
+  SubTetKernel(node_reference_coords, sub_tet_volumes, sub_tet_grads);
+
+  for (int n = 0; n < num_nodes_; n++) { lumped_mass[n] = 0.0; }
+
+  // Each sub-tetrahedron splits its mass evenly over its nodes
+  for (int s = 0; s < num_sub_tets_; s++) {
+    const double node_mass = 0.25 * density * sub_tet_volumes[s];
+    for (int i = 0; i < 4; i++) {
+      const int node = SubTetNode(s, i);
+      if (node < num_nodes_) {
+        lumped_mass[node] += node_mass;
+      } else {
+        for (int m = Tet10Topology::num_vertices; m < num_nodes_; m++) { lumped_mass[m] += node_mass / 6.0; }
+      }
+    }
+  }
+}
+
+void
+CompositeTet10Element::ComputeLumpedMass(
+    const double  density,
+    const double* node_reference_coords,
+    double*       lumped_mass) const
+{
+  LumpedMassKernel(density, node_reference_coords, lumped_mass);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+void
+CompositeTet10Element::ComputeLumpedMass(
+    const double                                   density,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceScalarNodeGatheredSubView lumped_mass) const
+{
+  double ref_coord[num_nodes_ * dim_];
+  double mass[num_nodes_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) { ref_coord[dim_ * n + i] = node_reference_coords(n, i); }
+  }
+  LumpedMassKernel(density, ref_coord, mass);
+  for (int n = 0; n < num_nodes_; n++) { lumped_mass(n) = mass[n]; }
+}
+#endif
+
+double
+CompositeTet10Element::ComputeCharacteristicLength(const double* node_coords)
+{
+  return CharacteristicLengthKernel(node_coords);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+double
+CompositeTet10Element::ComputeCharacteristicLength(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements) const
+{
+  double cur_coord[num_nodes_ * dim_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  return CharacteristicLengthKernel(cur_coord);
+}
+#endif
+
+double
+CompositeTet10Element::CharacteristicLengthKernel(const double* node_coords) const
+{
+  const int faces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+
+  double x[(num_nodes_ + 1) * dim_];
+  double sub_tet_volumes[num_sub_tets_];
+  double sub_tet_grads[num_sub_tets_ * 4 * dim_];
+  ExtendedCoordinates(node_coords, x);
+  SubTetKernel(node_coords, sub_tet_volumes, sub_tet_grads);
+
+  // Smallest altitude 3 V / A_face over the sub-tetrahedra
+  double length = std::numeric_limits<double>::max();
+  for (int s = 0; s < num_sub_tets_; s++) {
+    double max_twice_area = 0.0;
+    for (int f = 0; f < 4; f++) {
+      const double* p0  = &x[dim_ * SubTetNode(s, faces[f][0])];
+      const double* p1  = &x[dim_ * SubTetNode(s, faces[f][1])];
+      const double* p2  = &x[dim_ * SubTetNode(s, faces[f][2])];
+      double        u[] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+      double        v[] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+      double        cx  = u[1] * v[2] - u[2] * v[1];
+      double        cy  = u[2] * v[0] - u[0] * v[2];
+      double        cz  = u[0] * v[1] - u[1] * v[0];
+
+      double twice_area = sqrt(cx * cx + cy * cy + cz * cz);
+      if (twice_area > max_twice_area) { max_twice_area = twice_area; }
+    }
+    double altitude = 6.0 * sub_tet_volumes[s] / max_twice_area;
+    if (altitude < length) { length = altitude; }
+  }
+
+  return length;
+}
+
+double
+CompositeTet10Element::VolumeAverageKernel(
+    const double* node_current_coords,
+    int           num_quantities,
+    const double* int_pt_quantities,
+    double*       volume_averaged_quantities) const
+{
+  double sub_tet_volumes[num_sub_tets_];
+  double sub_tet_grads[num_sub_tets_ * 4 * dim_];
+  double volume = SubTetKernel(node_current_coords, sub_tet_volumes, sub_tet_grads);
+
+  // The integration points carry equal weights
+  for (int i_quantity = 0; i_quantity < num_quantities; i_quantity++) {
+    double sum = 0.0;
+    for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+      sum += int_pt_quantities[int_pt * num_quantities + i_quantity];
+    }
+    volume_averaged_quantities[i_quantity] = sum / num_int_pts_;
+  }
+
+  return volume;
+}
+
+void
+CompositeTet10Element::ComputeVolumeAverage(
+    const double* node_current_coords,
+    int           num_quantities,
+    const double* int_pt_quantities,
+    double&       volume,
+    double*       volume_averaged_quantities) const
+{
+  volume = VolumeAverageKernel(node_current_coords, num_quantities, int_pt_quantities, volume_averaged_quantities);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+void
+CompositeTet10Element::ComputeVolume(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+    nimble_kokkos::DeviceScalarElemSingleEntryView elem_volume) const
+{
+  double cur_coord[num_nodes_ * dim_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+
+  // See HexElement::ComputeVolume() regarding the raw pointer
+  double* v = elem_volume.data();
+  *v        = VolumeAverageKernel(cur_coord, 0, nullptr, nullptr);
+}
+
+void
+CompositeTet10Element::ComputeVolumeAverageSymTensor(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView    node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView    node_displacements,
+    nimble_kokkos::DeviceSymTensorIntPtSubView        int_pt_quantities,
+    nimble_kokkos::DeviceSymTensorElemSingleEntryView vol_ave_quantity) const
+{
+  const int num_quantities = 6;
+  double    cur_coord[num_nodes_ * dim_];
+  double    quantities[num_int_pts_ * num_quantities];
+  double    vol_ave[num_quantities];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    for (int i = 0; i < num_quantities; i++) { quantities[int_pt * num_quantities + i] = int_pt_quantities(int_pt, i); }
+  }
+  VolumeAverageKernel(cur_coord, num_quantities, quantities, vol_ave);
+  for (int i = 0; i < num_quantities; i++) { vol_ave_quantity(i) = vol_ave[i]; }
+}
+
+void
+CompositeTet10Element::ComputeVolumeAverageFullTensor(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView     node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView     node_displacements,
+    nimble_kokkos::DeviceFullTensorIntPtSubView        int_pt_quantities,
+    nimble_kokkos::DeviceFullTensorElemSingleEntryView vol_ave_quantity) const
+{
+  const int num_quantities = 9;
+  double    cur_coord[num_nodes_ * dim_];
+  double    quantities[num_int_pts_ * num_quantities];
+  double    vol_ave[num_quantities];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    for (int i = 0; i < num_quantities; i++) { quantities[int_pt * num_quantities + i] = int_pt_quantities(int_pt, i); }
+  }
+  VolumeAverageKernel(cur_coord, num_quantities, quantities, vol_ave);
+  for (int i = 0; i < num_quantities; i++) { vol_ave_quantity(i) = vol_ave[i]; }
+}
+#endif
+
+void
+CompositeTet10Element::DeformationGradientsKernel(
+    const double* node_reference_coords,
+    const double* node_current_coords,
+    double*       deformation_gradients) const
+{
+  const int full_tensor_index[3][3] = {{K_F_XX, K_F_XY, K_F_XZ}, {K_F_YX, K_F_YY, K_F_YZ}, {K_F_ZX, K_F_ZY, K_F_ZZ}};
+  double    proj_grad[num_int_pts_ * num_nodes_ * dim_];
+
+  // \bar{F} = \sum_{i}^{N_{node}} x_{i} \otimes \tilde{G}_{i}, with the projected reference gradients
+  ProjectedGradientsKernel(node_reference_coords, proj_grad);
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    const double* grad = &proj_grad[num_nodes_ * dim_ * int_pt];
+    for (int j = 0; j < dim_; j++) {
+      for (int k = 0; k < dim_; k++) {
+        double def_grad = 0.0;
+        for (int n = 0; n < num_nodes_; n++) { def_grad += node_current_coords[dim_ * n + j] * grad[dim_ * n + k]; }
+        deformation_gradients[9 * int_pt + full_tensor_index[j][k]] = def_grad;
+      }
+    }
+  }
+}
+
+void
+CompositeTet10Element::ComputeDeformationGradients(
+    const double* node_reference_coords,
+    const double* node_current_coords,
+    double*       deformation_gradients) const
+{
+  DeformationGradientsKernel(node_reference_coords, node_current_coords, deformation_gradients);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+void
+CompositeTet10Element::ComputeDeformationGradients(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+    nimble_kokkos::DeviceFullTensorIntPtSubView    deformation_gradients) const
+{
+  double ref_coord[num_nodes_ * dim_];
+  double cur_coord[num_nodes_ * dim_];
+  double def_grad[num_int_pts_ * 9];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      ref_coord[dim_ * n + i] = node_reference_coords(n, i);
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  DeformationGradientsKernel(ref_coord, cur_coord, def_grad);
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    for (int i = 0; i < 9; i++) { deformation_gradients(int_pt, i) = def_grad[9 * int_pt + i]; }
+  }
+}
+#endif
+
+void
+CompositeTet10Element::ComputeTangent(
+    const double* node_current_coords,
+    const double* material_tangent,
+    double*       element_tangent)
+{
+  constexpr int num_dof = num_nodes_ * dim_;
+  double        proj_grad[num_int_pts_ * num_nodes_ * dim_];
+  double        B[6][num_dof];
+  double        temp[6][num_dof];
+
+  for (int i = 0; i < num_dof * num_dof; i++) { element_tangent[i] = 0.0; }
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < num_dof; j++) { B[i][j] = 0.0; }
+  }
+
+  double weight = ProjectedGradientsKernel(node_current_coords, proj_grad) / num_int_pts_;
+
+  // \mathbf{K}_{elem} = \int \mathbf{B}^{T} \mathbf{C} \mathbf{B} d\Omega, with the projected gradients in B
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    const double* grad = &proj_grad[num_nodes_ * dim_ * int_pt];
+    for (int n = 0; n < num_nodes_; n++) {
+      double dN_dcc1  = grad[3 * n];
+      double dN_dcc2  = grad[3 * n + 1];
+      double dN_dcc3  = grad[3 * n + 2];
+      B[0][3 * n]     = dN_dcc1;
+      B[1][3 * n + 1] = dN_dcc2;
+      B[2][3 * n + 2] = dN_dcc3;
+      B[3][3 * n]     = dN_dcc2;
+      B[3][3 * n + 1] = dN_dcc1;
+      B[4][3 * n + 1] = dN_dcc3;
+      B[4][3 * n + 2] = dN_dcc2;
+      B[5][3 * n]     = dN_dcc3;
+      B[5][3 * n + 2] = dN_dcc1;
+    }
+
+    for (int i = 0; i < 6; i++) {
+      for (int j = 0; j < num_dof; j++) {
+        temp[i][j] = 0.0;
+        for (int k = 0; k < 6; k++) { temp[i][j] += material_tangent[36 * int_pt + 6 * i + k] * B[k][j]; }
+      }
+    }
+
+    for (int i = 0; i < num_dof; i++) {
+      for (int j = 0; j < num_dof; j++) {
+        for (int k = 0; k < 6; k++) { element_tangent[i * num_dof + j] += B[k][i] * temp[k][j] * weight; }
+      }
+    }
+  }
+}
+
+void
+CompositeTet10Element::NodalForcesKernel(
+    const double* node_current_coords,
+    const double* int_pt_stresses,
+    double*       node_forces) const
+{
+  const int sym_tensor_index[3][3] = {{K_S_XX, K_S_XY, K_S_XZ}, {K_S_YX, K_S_YY, K_S_YZ}, {K_S_ZX, K_S_ZY, K_S_ZZ}};
+  const int sym_tensor_size        = 6;
+  double    proj_grad[num_int_pts_ * num_nodes_ * dim_];
+
+  for (int i = 0; i < num_nodes_ * dim_; i++) { node_forces[i] = 0.0; }
+
+  double weight = ProjectedGradientsKernel(node_current_coords, proj_grad) / num_int_pts_;
+
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    const double* grad = &proj_grad[num_nodes_ * dim_ * int_pt];
+    const double* sig  = &int_pt_stresses[sym_tensor_size * int_pt];
+    for (int n = 0; n < num_nodes_; n++) {
+      for (int i = 0; i < dim_; i++) {
+        double f = 0.0;
+        for (int j = 0; j < dim_; j++) { f += grad[dim_ * n + j] * sig[sym_tensor_index[j][i]]; }
+        node_forces[dim_ * n + i] -= weight * f;
+      }
+    }
+  }
+}
+
+void
+CompositeTet10Element::ComputeNodalForces(
+    const double* node_current_coords,
+    const double* int_pt_stresses,
+    double*       node_forces)
+{
+  NodalForcesKernel(node_current_coords, int_pt_stresses, node_forces);
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+void
+CompositeTet10Element::ComputeNodalForces(
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+    nimble_kokkos::DeviceSymTensorIntPtSubView     int_pt_stresses,
+    nimble_kokkos::DeviceVectorNodeGatheredSubView node_forces) const
+{
+  double cur_coord[num_nodes_ * dim_];
+  double stress[num_int_pts_ * 6];
+  double force[num_nodes_ * dim_];
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) {
+      cur_coord[dim_ * n + i] = node_reference_coords(n, i) + node_displacements(n, i);
+    }
+  }
+  for (int int_pt = 0; int_pt < num_int_pts_; int_pt++) {
+    for (int i = 0; i < 6; i++) { stress[6 * int_pt + i] = int_pt_stresses(int_pt, i); }
+  }
+  NodalForcesKernel(cur_coord, stress, force);
+  for (int n = 0; n < num_nodes_; n++) {
+    for (int i = 0; i < dim_; i++) { node_forces(n, i) = force[dim_ * n + i]; }
+  }
+}
+#endif
+
 }  // namespace nimble
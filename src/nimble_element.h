@@ -45,6 +45,7 @@
 #define NIMBLE_ELEMENT_H
 
 #include "nimble_defs.h"
+#include "nimble_element_traits.h"
 
 namespace nimble {
 
@@ -81,6 +82,14 @@ class Element
   virtual double
   ComputeCharacteristicLength(const double* node_coords) = 0;
 
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  virtual double
+  ComputeCharacteristicLength(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements) const = 0;
+#endif
+
   virtual void
   ComputeVolumeAverage(
       const double* node_current_coords,
@@ -146,6 +155,24 @@ class Element
       nimble_kokkos::DeviceVectorNodeGatheredSubView element_internal_force_d) const = 0;
 #endif
 
+  /// \brief Deformation gradients of up to NIMBLE_ELEMENT_BATCH_WIDTH elements
+  ///
+  /// Node data and deformation gradients are stored element-minor, entry i of
+  /// lane l is at [i * NIMBLE_ELEMENT_BATCH_WIDTH + l].  Lanes at or past
+  /// num_lanes are left untouched.  The default calls the single element kernel
+  /// for each lane.
+  virtual void
+  ComputeDeformationGradientsBatch(
+      int           num_lanes,
+      const double* node_reference_coords,
+      const double* node_current_coords,
+      double*       deformation_gradients);
+
+  /// \brief Nodal forces of up to NIMBLE_ELEMENT_BATCH_WIDTH elements, same layout as
+  /// ComputeDeformationGradientsBatch
+  virtual void
+  ComputeNodalForcesBatch(int num_lanes, const double* node_current_coords, const double* int_pt_stresses, double* node_forces);
+
   NIMBLE_INLINE_FUNCTION
   double
   Invert3x3(double mat[][3], double inv[][3]) const;
@@ -230,6 +257,14 @@ class HexElement : public Element
   double
   ComputeCharacteristicLength(const double* node_coords);
 
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  double
+  ComputeCharacteristicLength(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements) const;
+#endif
+
   void
   ComputeVolumeAverage(
       const double* node_current_coords,
@@ -295,6 +330,17 @@ class HexElement : public Element
       nimble_kokkos::DeviceVectorNodeGatheredSubView node_forces) const;
 #endif
 
+  void
+  ComputeDeformationGradientsBatch(
+      int           num_lanes,
+      const double* node_reference_coords,
+      const double* node_current_coords,
+      double*       deformation_gradients) override;
+
+  void
+  ComputeNodalForcesBatch(int num_lanes, const double* node_current_coords, const double* int_pt_stresses, double* node_forces)
+      override;
+
  protected:
   NIMBLE_FUNCTION
   void
@@ -304,10 +350,14 @@ class HexElement : public Element
   void
   ShapeFunctionDerivatives(const double* natural_coords, double* shape_function_derivatives);
 
+  NIMBLE_FUNCTION
+  double
+  CharacteristicLengthKernel(const double* node_coords) const;
+
  private:
-  static constexpr int dim_         = 3;
-  static constexpr int num_nodes_   = 8;
-  static constexpr int num_int_pts_ = 8;
+  static constexpr int dim_         = Hex8Topology::dim;
+  static constexpr int num_nodes_   = Hex8Topology::num_nodes;
+  static constexpr int num_int_pts_ = Hex8Topology::num_int_pts;
 
   double int_pts_[num_int_pts_ * dim_];
   double int_wts_[num_int_pts_];
@@ -315,6 +365,397 @@ class HexElement : public Element
   double shape_fcn_deriv_[num_nodes_ * num_int_pts_ * dim_];
 };
 
+/// \brief Isoparametric solid element with its topology fixed at compile time
+///
+/// Node and integration point counts come from the Topology traits in
+/// nimble_element_traits.h, so every kernel loop has compile-time bounds.  The
+/// shape functions and integration rule are specialized per topology in
+/// nimble_element.cc, which also holds the explicit instantiations.  The lumped
+/// mass uses HRZ diagonal scaling, which stays positive for quadratic elements
+/// where row summing does not.
+template <typename Topology>
+class SolidElement : public Element
+{
+ public:
+  NIMBLE_FUNCTION
+  SolidElement();
+
+  NIMBLE_FUNCTION
+  virtual ~SolidElement() {}
+
+  int
+  Dim() override
+  {
+    return dim_;
+  }
+
+  int
+  NumNodesPerElement() override
+  {
+    return num_nodes_;
+  }
+
+  int
+  NumIntegrationPointsPerElement() override
+  {
+    return num_int_pts_;
+  }
+
+  void
+  ComputeLumpedMass(const double density, const double* node_reference_coords, double* lumped_mass) const override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  ComputeLumpedMass(
+      const double                                   density,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceScalarNodeGatheredSubView lumped_mass) const override;
+#endif
+
+  /// \brief Smallest vertex altitude, divided by the polynomial order
+  double
+  ComputeCharacteristicLength(const double* node_coords) override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  double
+  ComputeCharacteristicLength(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements) const override;
+#endif
+
+  void
+  ComputeVolumeAverage(
+      const double* node_current_coords,
+      int           num_quantities,
+      const double* int_pt_quantities,
+      double&       volume,
+      double*       volume_averaged_quantity) const override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  ComputeVolume(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+      nimble_kokkos::DeviceScalarElemSingleEntryView elem_volume) const override;
+
+  NIMBLE_FUNCTION
+  void
+  ComputeVolumeAverageSymTensor(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView    node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView    node_displacements,
+      nimble_kokkos::DeviceSymTensorIntPtSubView        int_pt_quantities,
+      nimble_kokkos::DeviceSymTensorElemSingleEntryView vol_ave_quantity) const override;
+
+  NIMBLE_FUNCTION
+  void
+  ComputeVolumeAverageFullTensor(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView     node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView     node_displacements,
+      nimble_kokkos::DeviceFullTensorIntPtSubView        int_pt_quantities,
+      nimble_kokkos::DeviceFullTensorElemSingleEntryView vol_ave_quantity) const override;
+#endif
+
+  void
+  ComputeDeformationGradients(
+      const double* node_reference_coords,
+      const double* node_current_coords,
+      double*       deformation_gradients) const override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  ComputeDeformationGradients(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+      nimble_kokkos::DeviceFullTensorIntPtSubView    deformation_gradients) const override;
+#endif
+
+  void
+  ComputeTangent(const double* node_current_coords, const double* material_tangent, double* element_tangent) override;
+
+  void
+  ComputeNodalForces(const double* node_current_coords, const double* int_pt_stresses, double* node_forces) override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  ComputeNodalForces(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+      nimble_kokkos::DeviceSymTensorIntPtSubView     int_pt_stresses,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_forces) const override;
+#endif
+
+ protected:
+  /// \brief Integration points in natural coordinates and their weights
+  NIMBLE_FUNCTION
+  void
+  IntegrationRule(double* natural_coords, double* weights);
+
+  /// \brief Shape function values at one point in natural coordinates
+  NIMBLE_FUNCTION
+  void
+  ShapeFunctionValues(const double* natural_coords, double* shape_function_values);
+
+  /// \brief Shape function derivatives at one point in natural coordinates
+  NIMBLE_FUNCTION
+  void
+  ShapeFunctionDerivatives(const double* natural_coords, double* shape_function_derivatives);
+
+  /// \brief Spatial derivatives of the shape functions at an integration point
+  ///
+  /// \param int_pt Integration point index
+  /// \param node_coords Node coordinates, the derivatives are taken with respect to these
+  /// \param shape_fcn_grad Derivative of shape function n w.r.t. coordinate i at [dim * n + i]
+  ///
+  /// \return Determinant of the isoparametric Jacobian
+  NIMBLE_FUNCTION
+  double
+  ShapeFunctionGradients(int int_pt, const double* node_coords, double* shape_fcn_grad) const;
+
+  // Kernels shared by the host and Kokkos entry points
+
+  NIMBLE_FUNCTION
+  void
+  LumpedMassKernel(const double density, const double* node_reference_coords, double* lumped_mass) const;
+
+  NIMBLE_FUNCTION
+  double
+  CharacteristicLengthKernel(const double* node_coords) const;
+
+  NIMBLE_FUNCTION
+  double
+  VolumeAverageKernel(
+      const double* node_current_coords,
+      int           num_quantities,
+      const double* int_pt_quantities,
+      double*       volume_averaged_quantity) const;
+
+  NIMBLE_FUNCTION
+  void
+  DeformationGradientsKernel(
+      const double* node_reference_coords,
+      const double* node_current_coords,
+      double*       deformation_gradients) const;
+
+  NIMBLE_FUNCTION
+  void
+  NodalForcesKernel(const double* node_current_coords, const double* int_pt_stresses, double* node_forces) const;
+
+ private:
+  static constexpr int dim_         = Topology::dim;
+  static constexpr int num_nodes_   = Topology::num_nodes;
+  static constexpr int num_int_pts_ = Topology::num_int_pts;
+
+  double int_pts_[num_int_pts_ * dim_];
+  double int_wts_[num_int_pts_];
+  double shape_fcn_vals_[num_nodes_ * num_int_pts_];
+  double shape_fcn_deriv_[num_nodes_ * num_int_pts_ * dim_];
+};
+
+//! 4-node linear tetrahedron
+using TetElement = SolidElement<Tet4Topology>;
+
+//! 10-node quadratic tetrahedron
+using Tet10Element = SolidElement<Tet10Topology>;
+
+/// \brief Composite 10-node tetrahedron
+///
+/// The element is split into 12 linear sub-tetrahedra, four at the corners and
+/// eight around a center node placed at the average of the mid-edge nodes.  The
+/// piecewise constant deformation gradient of the sub-tetrahedra is projected
+/// onto a linear field over the element (Ostien et al., 2016), which is
+/// evaluated at the four integration points of Tet10Topology.  The projection
+/// removes the volumetric locking of the sub-tetrahedra, and the lumped mass,
+/// summed over the sub-tetrahedra, is positive at every node.
+///
+/// The nodal forces and the tangent use the same projection, evaluated in the
+/// current configuration.
+class CompositeTet10Element : public Element
+{
+ public:
+  NIMBLE_FUNCTION
+  CompositeTet10Element() {}
+
+  NIMBLE_FUNCTION
+  virtual ~CompositeTet10Element() {}
+
+  int
+  Dim() override
+  {
+    return dim_;
+  }
+
+  int
+  NumNodesPerElement() override
+  {
+    return num_nodes_;
+  }
+
+  int
+  NumIntegrationPointsPerElement() override
+  {
+    return num_int_pts_;
+  }
+
+  void
+  ComputeLumpedMass(const double density, const double* node_reference_coords, double* lumped_mass) const override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  ComputeLumpedMass(
+      const double                                   density,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceScalarNodeGatheredSubView lumped_mass) const override;
+#endif
+
+  /// \brief Smallest vertex altitude over the sub-tetrahedra
+  double
+  ComputeCharacteristicLength(const double* node_coords) override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  double
+  ComputeCharacteristicLength(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements) const override;
+#endif
+
+  void
+  ComputeVolumeAverage(
+      const double* node_current_coords,
+      int           num_quantities,
+      const double* int_pt_quantities,
+      double&       volume,
+      double*       volume_averaged_quantity) const override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  ComputeVolume(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+      nimble_kokkos::DeviceScalarElemSingleEntryView elem_volume) const override;
+
+  NIMBLE_FUNCTION
+  void
+  ComputeVolumeAverageSymTensor(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView    node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView    node_displacements,
+      nimble_kokkos::DeviceSymTensorIntPtSubView        int_pt_quantities,
+      nimble_kokkos::DeviceSymTensorElemSingleEntryView vol_ave_quantity) const override;
+
+  NIMBLE_FUNCTION
+  void
+  ComputeVolumeAverageFullTensor(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView     node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView     node_displacements,
+      nimble_kokkos::DeviceFullTensorIntPtSubView        int_pt_quantities,
+      nimble_kokkos::DeviceFullTensorElemSingleEntryView vol_ave_quantity) const override;
+#endif
+
+  void
+  ComputeDeformationGradients(
+      const double* node_reference_coords,
+      const double* node_current_coords,
+      double*       deformation_gradients) const override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  ComputeDeformationGradients(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+      nimble_kokkos::DeviceFullTensorIntPtSubView    deformation_gradients) const override;
+#endif
+
+  void
+  ComputeTangent(const double* node_current_coords, const double* material_tangent, double* element_tangent) override;
+
+  void
+  ComputeNodalForces(const double* node_current_coords, const double* int_pt_stresses, double* node_forces) override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  ComputeNodalForces(
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_reference_coords,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_displacements,
+      nimble_kokkos::DeviceSymTensorIntPtSubView     int_pt_stresses,
+      nimble_kokkos::DeviceVectorNodeGatheredSubView node_forces) const override;
+#endif
+
+  /// \brief Projected shape function gradients at the integration points
+  ///
+  /// \param node_coords Node coordinates, the gradients are taken with respect to these
+  /// \param proj_grad Gradient for node n at integration point q at [(q * num_nodes + n) * dim + i]
+  ///
+  /// \return Element volume, the sum of the sub-tetrahedron volumes
+  NIMBLE_FUNCTION
+  double
+  ProjectedGradientsKernel(const double* node_coords, double* proj_grad) const;
+
+  static constexpr int num_sub_tets_ = 12;
+
+ protected:
+  NIMBLE_FUNCTION
+  void
+  LumpedMassKernel(const double density, const double* node_reference_coords, double* lumped_mass) const;
+
+  NIMBLE_FUNCTION
+  double
+  CharacteristicLengthKernel(const double* node_coords) const;
+
+  NIMBLE_FUNCTION
+  double
+  VolumeAverageKernel(
+      const double* node_current_coords,
+      int           num_quantities,
+      const double* int_pt_quantities,
+      double*       volume_averaged_quantity) const;
+
+  NIMBLE_FUNCTION
+  void
+  DeformationGradientsKernel(
+      const double* node_reference_coords,
+      const double* node_current_coords,
+      double*       deformation_gradients) const;
+
+  NIMBLE_FUNCTION
+  void
+  NodalForcesKernel(const double* node_current_coords, const double* int_pt_stresses, double* node_forces) const;
+
+  /// \brief Node i of a sub-tetrahedron, node num_nodes_ is the center node
+  NIMBLE_FUNCTION
+  int
+  SubTetNode(int sub_tet, int i) const;
+
+  /// \brief Coordinates of the element nodes followed by the center node
+  NIMBLE_FUNCTION
+  void
+  ExtendedCoordinates(const double* node_coords, double* extended_coords) const;
+
+  /// \brief Volume and linear shape function gradients of each sub-tetrahedron
+  ///
+  /// \param node_coords Node coordinates
+  /// \param sub_tet_volumes Volume of each sub-tetrahedron
+  /// \param sub_tet_grads Gradient for node i of sub-tetrahedron s at [(4 * s + i) * dim + k]
+  ///
+  /// \return Element volume
+  NIMBLE_FUNCTION
+  double
+  SubTetKernel(const double* node_coords, double* sub_tet_volumes, double* sub_tet_grads) const;
+
+ private:
+  static constexpr int dim_         = Tet10Topology::dim;
+  static constexpr int num_nodes_   = Tet10Topology::num_nodes;
+  static constexpr int num_int_pts_ = Tet10Topology::num_int_pts;
+};
+
 }  // namespace nimble
 
 #endif  // NIMBLE_ELEMENT_H
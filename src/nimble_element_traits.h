@@ -0,0 +1,94 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef NIMBLE_ELEMENT_TRAITS_H
+#define NIMBLE_ELEMENT_TRAITS_H
+
+namespace nimble {
+
+//! 8-node trilinear hexahedron, 2x2x2 Gauss integration
+struct Hex8Topology
+{
+  static constexpr int dim          = 3;
+  static constexpr int num_nodes    = 8;
+  static constexpr int num_int_pts  = 8;
+  static constexpr int num_vertices = 8;
+  static constexpr int order        = 1;
+};
+
+//! 4-node linear tetrahedron, one point integration
+struct Tet4Topology
+{
+  static constexpr int dim          = 3;
+  static constexpr int num_nodes    = 4;
+  static constexpr int num_int_pts  = 1;
+  static constexpr int num_vertices = 4;
+  static constexpr int order        = 1;
+};
+
+//! 10-node quadratic tetrahedron, four point integration
+//!
+//! Exodus node ordering, vertices 0-3 then the mid-edge nodes of edges
+//! 0-1, 1-2, 2-0, 0-3, 1-3 and 2-3.
+struct Tet10Topology
+{
+  static constexpr int dim          = 3;
+  static constexpr int num_nodes    = 10;
+  static constexpr int num_int_pts  = 4;
+  static constexpr int num_vertices = 4;
+  static constexpr int order        = 2;
+};
+
+//! Largest node and integration point counts over the supported topologies,
+//! used to size the fixed-extent Kokkos integration point views and the
+//! scratch arrays of the batched host kernels
+struct MaxElementTopology
+{
+  static constexpr int num_nodes   = 10;
+  static constexpr int num_int_pts = 8;
+};
+
+}  // namespace nimble
+
+#endif  // NIMBLE_ELEMENT_TRAITS_H
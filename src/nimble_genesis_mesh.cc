@@ -495,6 +495,7 @@ GenesisMesh::GetElementType(int block_id) const
       case 3: elem_type = "TRIANGLE"; break;
       case 4: elem_type = "TETRA"; break;
       case 8: elem_type = "HEX"; break;
+      case 10: elem_type = "TETRA10"; break;
       default: elem_type = "UNKNOWN"; break;
     }
   }
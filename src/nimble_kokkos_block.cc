@@ -44,12 +44,21 @@
 #include <nimble_kokkos_block.h>
 #include <nimble_kokkos_material_factory.h>
 
+#include <stdexcept>
+
 namespace nimble_kokkos {
 
 void
-Block::Initialize(std::string const& model_material_parameters, int num_elements, MaterialFactory& factory)
+Block::Initialize(
+    std::string const& model_material_parameters,
+    std::string const& element_type,
+    std::string const& element_formulation,
+    int                num_elements,
+    MaterialFactory&   factory)
 {
   model_material_parameters_ = model_material_parameters;
+  element_type_              = element_type;
+  element_formulation_       = element_formulation;
   InstantiateElement();
   int num_material_points = num_elements * element_->NumIntegrationPointsPerElement();
   InstantiateMaterialModel(num_material_points, factory);
@@ -64,17 +73,47 @@ Block::InstantiateMaterialModel(int num_material_points, MaterialFactory& factor
   ngp_lame_data_   = factory.get_ngp_lame_data();
 }
 
+template <typename ElementT>
 void
-Block::InstantiateElement()
+Block::InstantiateElementOfType()
 {
   // instantiate the element on the host (eventually we won't need this)
-  element_ = std::make_shared<nimble::HexElement>();
+  element_ = std::make_shared<ElementT>();
 
   // instantiate the element on the device
-  element_device_ = static_cast<nimble::Element*>(Kokkos::kokkos_malloc<>("Element", sizeof(nimble::HexElement)));
+  element_device_ = static_cast<nimble::Element*>(Kokkos::kokkos_malloc<>("Element", sizeof(ElementT)));
   nimble::Element* pointer_that_lives_on_the_stack = element_device_;
   Kokkos::parallel_for(
-      1, KOKKOS_LAMBDA(int) { new (pointer_that_lives_on_the_stack) nimble::HexElement(); });
+      1, KOKKOS_LAMBDA(int) { new (pointer_that_lives_on_the_stack) ElementT(); });
+}
+
+void
+Block::InstantiateElement()
+{
+  // Nodal averaging needs a node to element pass that the device pipeline does not have
+  if (element_formulation_ == "nodal_averaged") {
+    throw std::invalid_argument(
+        "\nError in nimble_kokkos::Block::InstantiateElement(), formulation nodal_averaged is not available with "
+        "Kokkos\n");
+  }
+  if (element_formulation_ == "composite" && element_type_ != "TETRA10") {
+    throw std::invalid_argument(
+        "\nError in nimble_kokkos::Block::InstantiateElement(), formulation composite is not available for element "
+        "type " + element_type_ + "\n");
+  }
+
+  if (element_type_ == "HEX") {
+    InstantiateElementOfType<nimble::HexElement>();
+  } else if (element_type_ == "TETRA") {
+    InstantiateElementOfType<nimble::TetElement>();
+  } else if (element_type_ == "TETRA10" && element_formulation_ == "composite") {
+    InstantiateElementOfType<nimble::CompositeTet10Element>();
+  } else if (element_type_ == "TETRA10") {
+    InstantiateElementOfType<nimble::Tet10Element>();
+  } else {
+    throw std::invalid_argument(
+        "\nError in nimble_kokkos::Block::InstantiateElement(), unsupported element type " + element_type_ + "\n");
+  }
 }
 
 }  // namespace nimble_kokkos
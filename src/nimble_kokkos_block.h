@@ -86,7 +86,12 @@ class Block : public nimble::BlockBase
   }
 
   void
-  Initialize(std::string const& model_material_parameters, int num_elements, MaterialFactory& factory);
+  Initialize(
+      std::string const& model_material_parameters,
+      std::string const& element_type,
+      std::string const& element_formulation,
+      int                num_elements,
+      MaterialFactory&   factory);
 
   void
   InstantiateMaterialModel(int num_material_points, MaterialFactory& factory);
@@ -94,6 +99,14 @@ class Block : public nimble::BlockBase
   void
   InstantiateElement() override;
 
+  /// \brief Create the host element and placement-new its device copy
+  ///
+  /// Public because it holds a KOKKOS_LAMBDA, which CUDA does not allow in
+  /// private member functions.
+  template <typename ElementT>
+  void
+  InstantiateElementOfType();
+
   std::shared_ptr<nimble::Element>
   GetHostElement()
   {
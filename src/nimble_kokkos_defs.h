@@ -47,7 +47,14 @@
 #define NIMBLE_FUNCTION KOKKOS_FUNCTION
 #define NIMBLE_INLINE_FUNCTION KOKKOS_INLINE_FUNCTION
 
+#include <type_traits>
+
 #include "Kokkos_Core.hpp"
+#ifndef KOKKOS_ENABLE_QTHREADS
+#include "Kokkos_ScatterView.hpp"
+#endif
+
+#include "nimble_element_traits.h"
 
 namespace nimble_kokkos {
 
@@ -85,6 +92,42 @@ using kokkos_device = Kokkos::Device<kokkos_device_execution_space, kokkos_devic
 
 using kokkos_layout = kokkos_device_execution_space::array_layout;
 
+// Each class of field gets the layout and memory space that suits its access
+// pattern, any of them can be overridden at build time with the macro named
+// alongside it.
+
+// Node fields are gathered through the element connectivity, keeping the
+// components of a node contiguous turns each gather into a single short read
+#ifdef NIMBLE_KOKKOS_NODE_LAYOUT
+using kokkos_node_layout = NIMBLE_KOKKOS_NODE_LAYOUT;
+#else
+using kokkos_node_layout = Kokkos::LayoutRight;
+#endif
+
+// Integration point, gathered and element fields are traversed element by
+// element, the execution space layout keeps an element contiguous on the host
+// and coalesces neighbouring elements on a GPU
+#ifdef NIMBLE_KOKKOS_ELEMENT_LAYOUT
+using kokkos_element_layout = NIMBLE_KOKKOS_ELEMENT_LAYOUT;
+#else
+using kokkos_element_layout = kokkos_layout;
+#endif
+
+// Element fields are only written at output steps and then read on the host,
+// on a discrete GPU they live in pinned host memory so no copy is needed
+#if defined(NIMBLE_KOKKOS_OUTPUT_MEMORY_SPACE)
+using kokkos_output_memory_space = NIMBLE_KOKKOS_OUTPUT_MEMORY_SPACE;
+#elif defined(KOKKOS_ENABLE_CUDA) && !defined(KOKKOS_ENABLE_CUDA_UVM)
+using kokkos_output_memory_space = Kokkos::CudaHostPinnedSpace;
+#else
+using kokkos_output_memory_space = kokkos_device_memory_space;
+#endif
+using kokkos_output_device = Kokkos::Device<kokkos_device_execution_space, kokkos_output_memory_space>;
+using kokkos_output_host   = typename std::conditional<
+    Kokkos::SpaceAccessibility<Kokkos::HostSpace, kokkos_output_memory_space>::accessible,
+    Kokkos::Device<kokkos_host_execution_space, kokkos_output_memory_space>,
+    kokkos_host>::type;
+
 enum class FieldType : int
 {
   HostScalarNode,
@@ -154,8 +197,10 @@ class FieldBase
 
   virtual ~FieldBase() = default;
 
-  static constexpr int NUM_NODES_IN_HEX              = 8;
-  static constexpr int NUM_INTEGRATION_POINTS_IN_HEX = 8;
+  // Integration point views are sized for the largest supported element topology,
+  // smaller elements leave the trailing integration points unused.  The gathered
+  // node views take the node count of their block at run time.
+  static constexpr int MAX_INTEGRATION_POINTS_PER_ELEMENT = nimble::MaxElementTopology::num_int_pts;
 
  private:
   FieldType   type_{};
@@ -193,10 +238,16 @@ class Field<FieldType::DeviceScalarNode> : public FieldBase
 {
  public:
   // (node)
-  using View            = Kokkos::View<double*, kokkos_layout, kokkos_device>;
-  using AtomicView      = Kokkos::View<double*, kokkos_layout, kokkos_device, Kokkos::MemoryTraits<Kokkos::Atomic>>;
-  using GatheredView    = Kokkos::View<double* [NUM_NODES_IN_HEX], kokkos_layout, kokkos_device>;
+  using View = Kokkos::View<double*, kokkos_node_layout, kokkos_device>;
+  using AtomicView =
+      Kokkos::View<double*, kokkos_node_layout, kokkos_device, Kokkos::MemoryTraits<Kokkos::Atomic>>;
+  // (elem, node)
+  using GatheredView    = Kokkos::View<double**, kokkos_element_layout, kokkos_device>;
   using GatheredSubView = decltype(Kokkos::subview(*(GatheredView*)(0), (int)(0), Kokkos::ALL));
+#ifndef KOKKOS_ENABLE_QTHREADS
+  // duplicated or atomic according to the default for the execution space
+  using ScatterView = decltype(Kokkos::Experimental::create_scatter_view(*(View*)(0)));
+#endif
 
   Field(const std::string& name, int num_entries)
       : FieldBase(name, FieldType::DeviceScalarNode), data_(name, num_entries)
@@ -220,7 +271,7 @@ class Field<FieldType::HostVectorNode> : public FieldBase
 {
  public:
   // (node, coordinate)
-  using View = Kokkos::View<double* [3], kokkos_layout, kokkos_host>;
+  using View = Kokkos::View<double* [3], kokkos_node_layout, kokkos_host>;
 
   Field(const std::string& name, int num_entries) : FieldBase(name, FieldType::HostVectorNode), data_(name, num_entries)
   {
@@ -243,10 +294,16 @@ class Field<FieldType::DeviceVectorNode> : public FieldBase
 {
  public:
   // (node, coordinate)
-  using View            = Kokkos::View<double* [3], kokkos_layout, kokkos_device>;
-  using AtomicView      = Kokkos::View<double* [3], kokkos_layout, kokkos_device, Kokkos::MemoryTraits<Kokkos::Atomic>>;
-  using GatheredView    = Kokkos::View<double* [NUM_NODES_IN_HEX][3], kokkos_layout, kokkos_device>;
+  using View = Kokkos::View<double* [3], kokkos_node_layout, kokkos_device>;
+  using AtomicView =
+      Kokkos::View<double* [3], kokkos_node_layout, kokkos_device, Kokkos::MemoryTraits<Kokkos::Atomic>>;
+  // (elem, node, coordinate)
+  using GatheredView    = Kokkos::View<double** [3], kokkos_element_layout, kokkos_device>;
   using GatheredSubView = decltype(Kokkos::subview(*(GatheredView*)(0), (int)(0), Kokkos::ALL, Kokkos::ALL));
+#ifndef KOKKOS_ENABLE_QTHREADS
+  // duplicated or atomic according to the default for the execution space
+  using ScatterView = decltype(Kokkos::Experimental::create_scatter_view(*(View*)(0)));
+#endif
 
   Field(const std::string& name, int num_entries)
       : FieldBase(name, FieldType::DeviceVectorNode), data_(name, num_entries)
@@ -270,7 +327,7 @@ class Field<FieldType::HostSymTensorIntPt> : public FieldBase
 {
  public:
   // (elem, ipt, tensor_index)
-  using View = Kokkos::View<double* [NUM_INTEGRATION_POINTS_IN_HEX][6], kokkos_layout, kokkos_host>;
+  using View = Kokkos::View<double* [MAX_INTEGRATION_POINTS_PER_ELEMENT][6], kokkos_element_layout, kokkos_host>;
 
   Field(const std::string& name, int num_entries)
       : FieldBase(name, FieldType::HostSymTensorIntPt), data_(name, num_entries)
@@ -294,7 +351,8 @@ class Field<FieldType::DeviceSymTensorIntPt> : public FieldBase
 {
  public:
   // (elem, ipt, tensor_index)
-  using View            = Kokkos::View<double* [NUM_INTEGRATION_POINTS_IN_HEX][6], kokkos_layout, kokkos_device>;
+  using View =
+      Kokkos::View<double* [MAX_INTEGRATION_POINTS_PER_ELEMENT][6], kokkos_element_layout, kokkos_device>;
   using SubView         = decltype(Kokkos::subview(*(View*)(0), (int)(0), Kokkos::ALL, Kokkos::ALL));
   using SingleEntryView = decltype(Kokkos::subview(*(View*)(0), (int)(0), (int)(0), Kokkos::ALL));
 
@@ -320,7 +378,7 @@ class Field<FieldType::HostFullTensorIntPt> : public FieldBase
 {
  public:
   // (elem, ipt, tensor_index)
-  using View = Kokkos::View<double* [NUM_INTEGRATION_POINTS_IN_HEX][9], kokkos_layout, kokkos_host>;
+  using View = Kokkos::View<double* [MAX_INTEGRATION_POINTS_PER_ELEMENT][9], kokkos_element_layout, kokkos_host>;
 
   Field(const std::string& name, int num_entries)
       : FieldBase(name, FieldType::HostFullTensorIntPt), data_(name, num_entries)
@@ -344,7 +402,8 @@ class Field<FieldType::DeviceFullTensorIntPt> : public FieldBase
 {
  public:
   // (elem, ipt, tensor_index)
-  using View            = Kokkos::View<double* [NUM_INTEGRATION_POINTS_IN_HEX][9], kokkos_layout, kokkos_device>;
+  using View =
+      Kokkos::View<double* [MAX_INTEGRATION_POINTS_PER_ELEMENT][9], kokkos_element_layout, kokkos_device>;
   using SubView         = decltype(Kokkos::subview(*(View*)(0), (int)(0), Kokkos::ALL, Kokkos::ALL));
   using SingleEntryView = decltype(Kokkos::subview(*(View*)(0), (int)(0), (int)(0), Kokkos::ALL));
 
@@ -370,7 +429,7 @@ class Field<FieldType::HostScalarElem> : public FieldBase
 {
  public:
   // (elem)
-  using View = Kokkos::View<double*, kokkos_host>;
+  using View = Kokkos::View<double*, kokkos_output_host>;
 
   Field(const std::string& name, int num_entries) : FieldBase(name, FieldType::HostScalarElem), data_(name, num_entries)
   {
@@ -392,8 +451,8 @@ template <>
 class Field<FieldType::DeviceScalarElem> : public FieldBase
 {
  public:
-  // (node)
-  using View            = Kokkos::View<double*, kokkos_layout, kokkos_device>;
+  // (elem)
+  using View            = Kokkos::View<double*, kokkos_element_layout, kokkos_output_device>;
   using SingleEntryView = decltype(Kokkos::subview(*(View*)(0), (int)(0)));
 
   Field(const std::string& name, int num_entries)
@@ -418,7 +477,7 @@ class Field<FieldType::HostFullTensorElem> : public FieldBase
 {
  public:
   // (elem, ipt, tensor_index)
-  using View = Kokkos::View<double* [9], kokkos_layout, kokkos_host>;
+  using View = Kokkos::View<double* [9], kokkos_element_layout, kokkos_output_host>;
 
   Field(const std::string& name, int num_entries)
       : FieldBase(name, FieldType::HostFullTensorElem), data_(name, num_entries)
@@ -442,7 +501,7 @@ class Field<FieldType::DeviceFullTensorElem> : public FieldBase
 {
  public:
   // (elem, ipt, tensor_index)
-  using View            = Kokkos::View<double* [9], kokkos_layout, kokkos_device>;
+  using View            = Kokkos::View<double* [9], kokkos_element_layout, kokkos_output_device>;
   using SingleEntryView = decltype(Kokkos::subview(*(View*)(0), (int)(0), Kokkos::ALL));
 
   Field(const std::string& name, int num_entries)
@@ -467,7 +526,7 @@ class Field<FieldType::HostSymTensorElem> : public FieldBase
 {
  public:
   // (elem, ipt, tensor_index)
-  using View = Kokkos::View<double* [6], kokkos_layout, kokkos_host>;
+  using View = Kokkos::View<double* [6], kokkos_element_layout, kokkos_output_host>;
 
   Field(const std::string& name, int num_entries)
       : FieldBase(name, FieldType::HostSymTensorElem), data_(name, num_entries)
@@ -491,7 +550,7 @@ class Field<FieldType::DeviceSymTensorElem> : public FieldBase
 {
  public:
   // (elem, ipt, tensor_index)
-  using View            = Kokkos::View<double* [6], kokkos_layout, kokkos_device>;
+  using View            = Kokkos::View<double* [6], kokkos_element_layout, kokkos_output_device>;
   using SingleEntryView = decltype(Kokkos::subview(*(View*)(0), (int)(0), Kokkos::ALL));
 
   Field(const std::string& name, int num_entries)
@@ -522,6 +581,8 @@ typedef Kokkos::View<int*, kokkos_host>             HostIntegerArrayView;
 typedef Kokkos::View<int*, kokkos_host> HostElementConnectivityView;  // TODO THIS SHOULD BE A 2D ARRAY, BUT IT'S
                                                                       // TRICKY BECAUSE NUM NODES PER ELEMENT IS NOT
                                                                       // KNOWN
+typedef Kokkos::View<const int*, kokkos_host, Kokkos::MemoryTraits<Kokkos::Unmanaged>>
+    HostElementConnectivityUnmanagedConstView;
 
 typedef Field<FieldType::DeviceScalarNode>::View                 DeviceScalarNodeView;
 typedef Field<FieldType::DeviceScalarNode>::GatheredView         DeviceScalarNodeGatheredView;
@@ -529,6 +590,10 @@ typedef Field<FieldType::DeviceScalarNode>::GatheredSubView      DeviceScalarNod
 typedef Field<FieldType::DeviceVectorNode>::View                 DeviceVectorNodeView;
 typedef Field<FieldType::DeviceVectorNode>::GatheredView         DeviceVectorNodeGatheredView;
 typedef Field<FieldType::DeviceVectorNode>::GatheredSubView      DeviceVectorNodeGatheredSubView;
+#ifndef KOKKOS_ENABLE_QTHREADS
+typedef Field<FieldType::DeviceScalarNode>::ScatterView DeviceScalarNodeScatterView;
+typedef Field<FieldType::DeviceVectorNode>::ScatterView DeviceVectorNodeScatterView;
+#endif
 typedef Field<FieldType::DeviceFullTensorIntPt>::View            DeviceFullTensorIntPtView;
 typedef Field<FieldType::DeviceFullTensorIntPt>::SubView         DeviceFullTensorIntPtSubView;
 typedef Field<FieldType::DeviceFullTensorIntPt>::SingleEntryView DeviceFullTensorIntPtSingleEntryView;
@@ -542,6 +607,10 @@ typedef Field<FieldType::DeviceFullTensorElem>::SingleEntryView  DeviceFullTenso
 typedef Field<FieldType::DeviceSymTensorElem>::View              DeviceSymTensorElemView;
 typedef Field<FieldType::DeviceSymTensorElem>::SingleEntryView   DeviceSymTensorElemSingleEntryView;
 typedef Kokkos::View<int*, kokkos_device>                        DeviceIntegerArrayView;
+// (elem, ipt, state_variable_index)
+typedef Kokkos::View<double***, kokkos_element_layout, kokkos_device> DeviceStateVariableIntPtView;
+typedef decltype(Kokkos::subview(*(DeviceStateVariableIntPtView*)(0), (int)(0), (int)(0), Kokkos::ALL))
+    DeviceStateVariableIntPtSingleEntryView;
 typedef Kokkos::View<int*, kokkos_device>                        DeviceElementConnectivityView;
 }  // namespace nimble_kokkos
 
@@ -44,12 +44,18 @@
 #include "nimble_kokkos_model_data.h"
 
 #include <Kokkos_ScatterView.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
+#include "nimble_boundary_condition_manager.h"
 #include "nimble_data_manager.h"
 #include "nimble_kokkos_block.h"
 #include "nimble_kokkos_material_factory.h"
+#include "nimble_material.h"
 #include "nimble_parser.h"
 #include "nimble_vector_communicator.h"
 
@@ -391,106 +397,89 @@ ExodusOutputManager::ComputeElementData(
   int                                           block_index;
   std::map<int, nimble_kokkos::Block>::iterator block_it;
 
-  // Element volume
-  if (output_element_volume_) {
-    for (block_index = 0, block_it = blocks.begin(); block_it != blocks.end(); block_index++, block_it++) {
-      int                                          block_id           = block_it->first;
-      nimble_kokkos::Block&                        block              = block_it->second;
-      nimble::Element*                             element_d          = block.GetDeviceElement();
-      int                                          num_elem_in_block  = mesh.GetNumElementsInBlock(block_id);
-      int                                          num_nodes_per_elem = mesh.GetNumNodesPerElement(block_id);
-      nimble_kokkos::DeviceElementConnectivityView elem_conn_d        = block.GetDeviceElementConnectivityView();
-      nimble_kokkos::DeviceVectorNodeGatheredView  gathered_reference_coordinate_block_d =
-          gathered_reference_coordinate_d.at(block_index);
-      nimble_kokkos::DeviceVectorNodeGatheredView gathered_displacement_block_d =
-          gathered_displacement_d.at(block_index);
-      nimble_kokkos::DeviceScalarElemView volume_d = model_data.GetDeviceScalarElementData(block_id, volume_field_id_);
-      Kokkos::parallel_for(
-          "Element Volume", num_elem_in_block, KOKKOS_LAMBDA(const int i_elem) {
-            nimble_kokkos::DeviceVectorNodeGatheredSubView element_reference_coordinate_d =
-                Kokkos::subview(gathered_reference_coordinate_block_d, i_elem, Kokkos::ALL, Kokkos::ALL);
-            nimble_kokkos::DeviceVectorNodeGatheredSubView element_displacement_d =
-                Kokkos::subview(gathered_displacement_block_d, i_elem, Kokkos::ALL, Kokkos::ALL);
-            nimble_kokkos::DeviceScalarElemSingleEntryView element_volume_d = Kokkos::subview(volume_d, i_elem);
-            element_d->ComputeVolume(element_reference_coordinate_d, element_displacement_d, element_volume_d);
-          });
-      nimble_kokkos::HostScalarElemView volume_h = model_data.GetHostScalarElementData(block_id, volume_field_id_);
-      deep_copy(volume_h, volume_d);
-    }
-  }
-
-  // Extract data for specific integration points
+  // Derived element data are evaluated block by block, only for the fields
+  // that the block actually writes.  The element volume is fused into the
+  // first volume-averaging kernel when possible, and each integration point
+  // field is extracted once rather than once per tensor component.
   for (block_index = 0, block_it = blocks.begin(); block_it != blocks.end(); block_index++, block_it++) {
-    int block_id          = block_it->first;
-    int num_elem_in_block = mesh.GetNumElementsInBlock(block_id);
+    int block_id = block_it->first;
+    if (elem_data_labels_.at(block_id).empty()) { continue; }
+
+    nimble_kokkos::Block&                       block             = block_it->second;
+    nimble::Element*                            element_d         = block.GetDeviceElement();
+    int                                         num_elem_in_block = mesh.GetNumElementsInBlock(block_id);
+    nimble_kokkos::DeviceVectorNodeGatheredView gathered_reference_coordinate_block_d =
+        gathered_reference_coordinate_d.at(block_index);
+    nimble_kokkos::DeviceVectorNodeGatheredView gathered_displacement_block_d = gathered_displacement_d.at(block_index);
+
+    bool                                volume_pending = output_element_volume_;
+    nimble_kokkos::DeviceScalarElemView volume_d;
+    if (output_element_volume_) { volume_d = model_data.GetDeviceScalarElementData(block_id, volume_field_id_); }
+
+    // Extract data for specific integration points
+    std::vector<int> extracted_field_ids;
     for (unsigned int i_data = 0; i_data < elem_data_labels_.at(block_id).size(); ++i_data) {
       int integration_point_index = elem_data_integration_point_index_.at(block_id).at(i_data);
-      if (integration_point_index != -1) {
-        int       iptdata_field_id = elem_data_iptdata_field_ids_.at(block_id).at(i_data);
-        int       edata_field_id   = elem_data_edata_field_ids_.at(block_id).at(i_data);
-        FieldType field_type       = elem_data_types_.at(block_id).at(i_data);
-        if (field_type == FieldType::HostSymTensorElem) {
-          nimble_kokkos::DeviceSymTensorIntPtView sym_tensor_data_step_np1_d =
-              model_data.GetDeviceSymTensorIntegrationPointData(block_id, iptdata_field_id, nimble::STEP_NP1);
-          nimble_kokkos::DeviceSymTensorElemView sym_tensor_data_single_int_pt_d =
-              model_data.GetDeviceSymTensorElementData(block_id, edata_field_id);
-          Kokkos::parallel_for(
-              "Extract Symmetric Tensor Integration Point Data for Output",
-              num_elem_in_block,
-              KOKKOS_LAMBDA(const int i_elem) {
-                nimble_kokkos::DeviceSymTensorIntPtSubView element_sym_tensor_step_np1_d =
-                    Kokkos::subview(sym_tensor_data_step_np1_d, i_elem, Kokkos::ALL, Kokkos::ALL);
-                nimble_kokkos::DeviceSymTensorElemSingleEntryView element_sym_tensor_single_int_pt_d =
-                    Kokkos::subview(sym_tensor_data_single_int_pt_d, i_elem, Kokkos::ALL);
-                for (int i = 0; i < element_sym_tensor_single_int_pt_d.extent(0); i++) {
-                  element_sym_tensor_single_int_pt_d(i) = element_sym_tensor_step_np1_d(integration_point_index, i);
-                }
-              });
-          nimble_kokkos::HostSymTensorElemView sym_tensor_data_single_int_pt_h =
-              model_data.GetHostSymTensorElementData(block_id, edata_field_id);
-          deep_copy(sym_tensor_data_single_int_pt_h, sym_tensor_data_single_int_pt_d);
-
-        } else if (field_type == FieldType::HostFullTensorElem) {
-          nimble_kokkos::DeviceFullTensorIntPtView full_tensor_data_step_np1_d =
-              model_data.GetDeviceFullTensorIntegrationPointData(block_id, iptdata_field_id, nimble::STEP_NP1);
-          nimble_kokkos::DeviceFullTensorElemView full_tensor_data_single_int_pt_d =
-              model_data.GetDeviceFullTensorElementData(block_id, edata_field_id);
-          Kokkos::parallel_for(
-              "Extract Full Tensor Integration Point Data for Output",
-              num_elem_in_block,
-              KOKKOS_LAMBDA(const int i_elem) {
-                nimble_kokkos::DeviceFullTensorIntPtSubView element_full_tensor_step_np1_d =
-                    Kokkos::subview(full_tensor_data_step_np1_d, i_elem, Kokkos::ALL, Kokkos::ALL);
-                nimble_kokkos::DeviceFullTensorElemSingleEntryView element_full_tensor_single_int_pt_d =
-                    Kokkos::subview(full_tensor_data_single_int_pt_d, i_elem, Kokkos::ALL);
-                for (int i = 0; i < element_full_tensor_single_int_pt_d.extent(0); i++) {
-                  element_full_tensor_single_int_pt_d(i) = element_full_tensor_step_np1_d(integration_point_index, i);
-                }
-              });
-          nimble_kokkos::HostFullTensorElemView full_tensor_data_single_int_pt_h =
-              model_data.GetHostFullTensorElementData(block_id, edata_field_id);
-          deep_copy(full_tensor_data_single_int_pt_h, full_tensor_data_single_int_pt_d);
-        }
+      if (integration_point_index == -1) { continue; }
+      int edata_field_id = elem_data_edata_field_ids_.at(block_id).at(i_data);
+      if (std::find(extracted_field_ids.begin(), extracted_field_ids.end(), edata_field_id) !=
+          extracted_field_ids.end()) {
+        continue;
+      }
+      extracted_field_ids.push_back(edata_field_id);
+      int       iptdata_field_id = elem_data_iptdata_field_ids_.at(block_id).at(i_data);
+      FieldType field_type       = elem_data_types_.at(block_id).at(i_data);
+      if (field_type == FieldType::HostSymTensorElem) {
+        nimble_kokkos::DeviceSymTensorIntPtView sym_tensor_data_step_np1_d =
+            model_data.GetDeviceSymTensorIntegrationPointData(block_id, iptdata_field_id, nimble::STEP_NP1);
+        nimble_kokkos::DeviceSymTensorElemView sym_tensor_data_single_int_pt_d =
+            model_data.GetDeviceSymTensorElementData(block_id, edata_field_id);
+        Kokkos::parallel_for(
+            "Extract Symmetric Tensor Integration Point Data for Output",
+            num_elem_in_block,
+            KOKKOS_LAMBDA(const int i_elem) {
+              nimble_kokkos::DeviceSymTensorIntPtSubView element_sym_tensor_step_np1_d =
+                  Kokkos::subview(sym_tensor_data_step_np1_d, i_elem, Kokkos::ALL, Kokkos::ALL);
+              nimble_kokkos::DeviceSymTensorElemSingleEntryView element_sym_tensor_single_int_pt_d =
+                  Kokkos::subview(sym_tensor_data_single_int_pt_d, i_elem, Kokkos::ALL);
+              for (int i = 0; i < element_sym_tensor_single_int_pt_d.extent(0); i++) {
+                element_sym_tensor_single_int_pt_d(i) = element_sym_tensor_step_np1_d(integration_point_index, i);
+              }
+            });
+        nimble_kokkos::HostSymTensorElemView sym_tensor_data_single_int_pt_h =
+            model_data.GetHostSymTensorElementData(block_id, edata_field_id);
+        deep_copy(sym_tensor_data_single_int_pt_h, sym_tensor_data_single_int_pt_d);
+
+      } else if (field_type == FieldType::HostFullTensorElem) {
+        nimble_kokkos::DeviceFullTensorIntPtView full_tensor_data_step_np1_d =
+            model_data.GetDeviceFullTensorIntegrationPointData(block_id, iptdata_field_id, nimble::STEP_NP1);
+        nimble_kokkos::DeviceFullTensorElemView full_tensor_data_single_int_pt_d =
+            model_data.GetDeviceFullTensorElementData(block_id, edata_field_id);
+        Kokkos::parallel_for(
+            "Extract Full Tensor Integration Point Data for Output",
+            num_elem_in_block,
+            KOKKOS_LAMBDA(const int i_elem) {
+              nimble_kokkos::DeviceFullTensorIntPtSubView element_full_tensor_step_np1_d =
+                  Kokkos::subview(full_tensor_data_step_np1_d, i_elem, Kokkos::ALL, Kokkos::ALL);
+              nimble_kokkos::DeviceFullTensorElemSingleEntryView element_full_tensor_single_int_pt_d =
+                  Kokkos::subview(full_tensor_data_single_int_pt_d, i_elem, Kokkos::ALL);
+              for (int i = 0; i < element_full_tensor_single_int_pt_d.extent(0); i++) {
+                element_full_tensor_single_int_pt_d(i) = element_full_tensor_step_np1_d(integration_point_index, i);
+              }
+            });
+        nimble_kokkos::HostFullTensorElemView full_tensor_data_single_int_pt_h =
+            model_data.GetHostFullTensorElementData(block_id, edata_field_id);
+        deep_copy(full_tensor_data_single_int_pt_h, full_tensor_data_single_int_pt_d);
       }
     }
-  }
 
-  // Volume averaging of symmetric and full tensors stored at integration points
-  for (block_index = 0, block_it = blocks.begin(); block_it != blocks.end(); block_index++, block_it++) {
-    int                                          block_id           = block_it->first;
-    nimble_kokkos::Block&                        block              = block_it->second;
-    nimble::Element*                             element_d          = block.GetDeviceElement();
-    int                                          num_elem_in_block  = mesh.GetNumElementsInBlock(block_id);
-    int                                          num_nodes_per_elem = mesh.GetNumNodesPerElement(block_id);
-    nimble_kokkos::DeviceElementConnectivityView elem_conn_d        = block.GetDeviceElementConnectivityView();
-    nimble_kokkos::DeviceVectorNodeGatheredView  gathered_reference_coordinate_block_d =
-        gathered_reference_coordinate_d.at(block_index);
-    nimble_kokkos::DeviceVectorNodeGatheredView gathered_displacement_block_d = gathered_displacement_d.at(block_index);
+    // Volume averaging of symmetric and full tensors stored at integration points
     for (auto& field_id : sym_tensor_field_ids_requiring_volume_average_.at(block_id)) {
       nimble_kokkos::DeviceSymTensorIntPtView sym_tensor_data_step_np1_d =
           model_data.GetDeviceSymTensorIntegrationPointData(block_id, field_id, nimble::STEP_NP1);
       nimble_kokkos::DeviceSymTensorElemView sym_tensor_data_vol_ave_d =
           model_data.GetDeviceSymTensorElementData(block_id, field_id);
+      bool compute_volume = volume_pending;
       Kokkos::parallel_for(
           "Volume Averaging Sym Tensor", num_elem_in_block, KOKKOS_LAMBDA(const int i_elem) {
             nimble_kokkos::DeviceVectorNodeGatheredSubView element_reference_coordinate_d =
@@ -506,7 +495,12 @@ ExodusOutputManager::ComputeElementData(
                 element_displacement_d,
                 element_sym_tensor_step_np1_d,
                 element_sym_tensor_vol_ave_d);
+            if (compute_volume) {
+              nimble_kokkos::DeviceScalarElemSingleEntryView element_volume_d = Kokkos::subview(volume_d, i_elem);
+              element_d->ComputeVolume(element_reference_coordinate_d, element_displacement_d, element_volume_d);
+            }
           });
+      volume_pending = false;
       nimble_kokkos::HostSymTensorElemView sym_tensor_data_vol_ave_h =
           model_data.GetHostSymTensorElementData(block_id, field_id);
       deep_copy(sym_tensor_data_vol_ave_h, sym_tensor_data_vol_ave_d);
@@ -516,6 +510,7 @@ ExodusOutputManager::ComputeElementData(
           model_data.GetDeviceFullTensorIntegrationPointData(block_id, field_id, nimble::STEP_NP1);
       nimble_kokkos::DeviceFullTensorElemView full_tensor_data_vol_ave_d =
           model_data.GetDeviceFullTensorElementData(block_id, field_id);
+      bool compute_volume = volume_pending;
       Kokkos::parallel_for(
           "Volume Averaging Full Tensor", num_elem_in_block, KOKKOS_LAMBDA(const int i_elem) {
             nimble_kokkos::DeviceVectorNodeGatheredSubView element_reference_coordinate_d =
@@ -531,11 +526,33 @@ ExodusOutputManager::ComputeElementData(
                 element_displacement_d,
                 element_full_tensor_step_np1_d,
                 element_full_tensor_vol_ave_d);
+            if (compute_volume) {
+              nimble_kokkos::DeviceScalarElemSingleEntryView element_volume_d = Kokkos::subview(volume_d, i_elem);
+              element_d->ComputeVolume(element_reference_coordinate_d, element_displacement_d, element_volume_d);
+            }
           });
+      volume_pending = false;
       nimble_kokkos::HostFullTensorElemView full_tensor_data_vol_ave_h =
           model_data.GetHostFullTensorElementData(block_id, field_id);
       deep_copy(full_tensor_data_vol_ave_h, full_tensor_data_vol_ave_d);
     }
+
+    // Element volume, when no volume-averaging kernel was available to carry it
+    if (volume_pending) {
+      Kokkos::parallel_for(
+          "Element Volume", num_elem_in_block, KOKKOS_LAMBDA(const int i_elem) {
+            nimble_kokkos::DeviceVectorNodeGatheredSubView element_reference_coordinate_d =
+                Kokkos::subview(gathered_reference_coordinate_block_d, i_elem, Kokkos::ALL, Kokkos::ALL);
+            nimble_kokkos::DeviceVectorNodeGatheredSubView element_displacement_d =
+                Kokkos::subview(gathered_displacement_block_d, i_elem, Kokkos::ALL, Kokkos::ALL);
+            nimble_kokkos::DeviceScalarElemSingleEntryView element_volume_d = Kokkos::subview(volume_d, i_elem);
+            element_d->ComputeVolume(element_reference_coordinate_d, element_displacement_d, element_volume_d);
+          });
+    }
+    if (output_element_volume_) {
+      nimble_kokkos::HostScalarElemView volume_h = model_data.GetHostScalarElementData(block_id, volume_field_id_);
+      deep_copy(volume_h, volume_d);
+    }
   }
 }
 
@@ -913,7 +930,12 @@ ModelData::InitializeBlocks(
     std::string const& model_material_parameters = parser_.GetModelMaterialParameters(block_id);
     int                num_elements_in_block     = mesh_.GetNumElementsInBlock(block_id);
     blocks_[block_id]                            = nimble_kokkos::Block();
-    blocks_.at(block_id).Initialize(model_material_parameters, num_elements_in_block, *material_factory_ptr);
+    blocks_.at(block_id).Initialize(
+        model_material_parameters,
+        mesh_.GetElementType(block_id),
+        parser_.GetElementFormulation(block_id),
+        num_elements_in_block,
+        *material_factory_ptr);
     //
     // MPI version use model_data.DeclareElementData(block_id,
     // data_labels_and_lengths);
@@ -938,10 +960,34 @@ ModelData::InitializeBlocks(
     if (parser_.GetOutputFieldString().find("volume") != std::string::npos) {
       AllocateElementData(block_id, nimble::SCALAR, "volume", num_elements_in_block);
     }
+
+    // material state variables for history-dependent models
+    auto material_h          = blocks_.at(block_id).GetHostMaterialModel();
+    int  num_state_variables = material_h->NumStateVariables();
+    if (num_state_variables > 0) {
+      int num_int_pts = blocks_.at(block_id).GetHostElement()->NumIntegrationPointsPerElement();
+      DeviceStateVariableIntPtView state_variables_step_n_d(
+          "state_variables_step_n", num_elements_in_block, num_int_pts, num_state_variables);
+      DeviceStateVariableIntPtView state_variables_step_np1_d(
+          "state_variables_step_np1", num_elements_in_block, num_int_pts, num_state_variables);
+      auto state_variables_h = Kokkos::create_mirror_view(state_variables_step_n_d);
+      for (int i_elem = 0; i_elem < num_elements_in_block; ++i_elem) {
+        for (int i_int_pt = 0; i_int_pt < num_int_pts; ++i_int_pt) {
+          for (int i_var = 0; i_var < num_state_variables; ++i_var) {
+            state_variables_h(i_elem, i_int_pt, i_var) = material_h->GetStateVariableInitialValue(i_var);
+          }
+        }
+      }
+      Kokkos::deep_copy(state_variables_step_n_d, state_variables_h);
+      Kokkos::deep_copy(state_variables_step_np1_d, state_variables_h);
+      state_variables_step_n_d_[block_id]   = state_variables_step_n_d;
+      state_variables_step_np1_d_[block_id] = state_variables_step_np1_d;
+    }
   }
 
-  // Initialize gathered containers when using explicit scheme
-  if (parser_.TimeIntegrationScheme() == "explicit") InitializeGatheredVectors(mesh_);
+  // Initialize gathered containers when using explicit scheme or dynamic relaxation
+  if (parser_.TimeIntegrationScheme() == "explicit" || parser_.TimeIntegrationScheme() == "dynamic relaxation")
+    InitializeGatheredVectors(mesh_);
 
   InitializeBlockData(data_manager);
 }
@@ -970,6 +1016,10 @@ ModelData::UpdateStates(const nimble::DataManager& data_manager)
     Kokkos::deep_copy(stress_step_n_d, stress_step_np1_d);
     block_index += 1;
   }
+
+  // Every state variable at n+1 is rewritten by the material, so swapping the
+  // time states avoids a copy
+  std::swap(state_variables_step_n_d_, state_variables_step_np1_d_);
 }
 
 nimble::Viewify<1>
@@ -998,20 +1048,24 @@ ModelData::InitializeGatheredVectors(const nimble::GenesisMesh& mesh_)
   int num_blocks = static_cast<int>(mesh_.GetNumBlocks());
 
   gathered_reference_coordinate_d.resize(
-      num_blocks, nimble_kokkos::DeviceVectorNodeGatheredView("gathered_reference_coordinates", 1));
-  gathered_displacement_d.resize(num_blocks, nimble_kokkos::DeviceVectorNodeGatheredView("gathered_displacement", 1));
+      num_blocks, nimble_kokkos::DeviceVectorNodeGatheredView("gathered_reference_coordinates", 1, 1));
+  gathered_displacement_d.resize(
+      num_blocks, nimble_kokkos::DeviceVectorNodeGatheredView("gathered_displacement", 1, 1));
   gathered_internal_force_d.resize(
-      num_blocks, nimble_kokkos::DeviceVectorNodeGatheredView("gathered_internal_force", 1));
-  gathered_contact_force_d.resize(num_blocks, nimble_kokkos::DeviceVectorNodeGatheredView("gathered_contact_force", 1));
+      num_blocks, nimble_kokkos::DeviceVectorNodeGatheredView("gathered_internal_force", 1, 1));
+  gathered_contact_force_d.resize(
+      num_blocks, nimble_kokkos::DeviceVectorNodeGatheredView("gathered_contact_force", 1, 1));
 
+  // The node extent is the node count of the block topology
   int block_index = 0;
   for (const auto& block_it : blocks_) {
-    int block_id          = block_it.first;
-    int num_elem_in_block = mesh_.GetNumElementsInBlock(block_id);
-    Kokkos::resize(gathered_reference_coordinate_d.at(block_index), num_elem_in_block);
-    Kokkos::resize(gathered_displacement_d.at(block_index), num_elem_in_block);
-    Kokkos::resize(gathered_internal_force_d.at(block_index), num_elem_in_block);
-    Kokkos::resize(gathered_contact_force_d.at(block_index), num_elem_in_block);
+    int block_id           = block_it.first;
+    int num_elem_in_block  = mesh_.GetNumElementsInBlock(block_id);
+    int num_nodes_per_elem = mesh_.GetNumNodesPerElement(block_id);
+    Kokkos::resize(gathered_reference_coordinate_d.at(block_index), num_elem_in_block, num_nodes_per_elem);
+    Kokkos::resize(gathered_displacement_d.at(block_index), num_elem_in_block, num_nodes_per_elem);
+    Kokkos::resize(gathered_internal_force_d.at(block_index), num_elem_in_block, num_nodes_per_elem);
+    Kokkos::resize(gathered_contact_force_d.at(block_index), num_elem_in_block, num_nodes_per_elem);
     block_index += 1;
   }
 }
@@ -1024,16 +1078,16 @@ ModelData::ComputeLumpedMass(nimble::DataManager& data_manager)
   auto&       field_ids_          = data_manager.GetFieldIDs();
   auto        vector_communicator = data_manager.GetVectorCommunicator();
 
-  int num_nodes  = static_cast<int>(mesh_.GetNumNodes());
   int num_blocks = static_cast<int>(mesh_.GetNumBlocks());
 
   std::vector<nimble_kokkos::DeviceScalarNodeGatheredView> gathered_lumped_mass_d(
-      num_blocks, nimble_kokkos::DeviceScalarNodeGatheredView("gathered_lumped_mass", 1));
+      num_blocks, nimble_kokkos::DeviceScalarNodeGatheredView("gathered_lumped_mass", 1, 1));
   int block_index = 0;
   for (const auto& block_it : blocks_) {
-    int block_id          = block_it.first;
-    int num_elem_in_block = mesh_.GetNumElementsInBlock(block_id);
-    Kokkos::resize(gathered_lumped_mass_d.at(block_index), num_elem_in_block);
+    int block_id           = block_it.first;
+    int num_elem_in_block  = mesh_.GetNumElementsInBlock(block_id);
+    int num_nodes_per_elem = mesh_.GetNumNodesPerElement(block_id);
+    Kokkos::resize(gathered_lumped_mass_d.at(block_index), num_elem_in_block, num_nodes_per_elem);
     block_index += 1;
   }
 
@@ -1042,9 +1096,14 @@ ModelData::ComputeLumpedMass(nimble::DataManager& data_manager)
 
   auto lumped_mass_d = GetDeviceScalarNodeData(field_ids_.lumped_mass);
   Kokkos::deep_copy(lumped_mass_d, (double)(0.0));
+#ifndef KOKKOS_ENABLE_QTHREADS
+  // lumped mass is computed once, the scatter view is not kept
+  auto lumped_mass_scatter_d = Kokkos::Experimental::create_scatter_view(lumped_mass_d);
+  lumped_mass_scatter_d.reset();
+#endif
 
-  auto reference_coordinate = GetVectorNodeData("reference_coordinate");
-  auto displacement         = GetVectorNodeData("displacement");
+  // The critical time step is evaluated in the current configuration
+  Kokkos::deep_copy(GetDeviceVectorNodeData(field_ids_.displacement), GetHostVectorNodeData(field_ids_.displacement));
 
   critical_time_step_ = std::numeric_limits<double>::max();
 
@@ -1056,16 +1115,18 @@ ModelData::ComputeLumpedMass(nimble::DataManager& data_manager)
     double                density            = block.GetDensity();
     int                   num_elem_in_block  = mesh_.GetNumElementsInBlock(block_id);
     int                   num_nodes_per_elem = mesh_.GetNumNodesPerElement(block_id);
+    double                sound_speed        = std::sqrt(block.GetBulkModulus() / density);
     int                   elem_conn_length   = num_elem_in_block * num_nodes_per_elem;
-    int const*            elem_conn          = mesh_.GetConnectivity(block_id);
 
-    nimble_kokkos::HostElementConnectivityView elem_conn_h("element_connectivity_h", elem_conn_length);
-    for (int i = 0; i < elem_conn_length; i++) { elem_conn_h(i) = elem_conn[i]; }
+    // The mesh connectivity is copied to the device directly, without staging
+    nimble_kokkos::HostElementConnectivityUnmanagedConstView elem_conn_h(
+        mesh_.GetConnectivity(block_id), elem_conn_length);
     auto&& elem_conn_d = block.GetDeviceElementConnectivityView();
     Kokkos::resize(elem_conn_d, elem_conn_length);
     Kokkos::deep_copy(elem_conn_d, elem_conn_h);
 
     auto gathered_reference_coordinate_block_d = gathered_reference_coordinate_d.at(block_index);
+    auto gathered_displacement_block_d         = gathered_displacement_d.at(block_index);
     auto gathered_lumped_mass_block_d          = gathered_lumped_mass_d.at(block_index);
 
     GatherVectorNodeData(
@@ -1075,6 +1136,9 @@ ModelData::ComputeLumpedMass(nimble::DataManager& data_manager)
         elem_conn_d,
         gathered_reference_coordinate_block_d);
 
+    GatherVectorNodeData(
+        field_ids_.displacement, num_elem_in_block, num_nodes_per_elem, elem_conn_d, gathered_displacement_block_d);
+
     // COMPUTE LUMPED MASS
     Kokkos::parallel_for(
         "Lumped Mass", num_elem_in_block, KOKKOS_LAMBDA(const int i_elem) {
@@ -1085,22 +1149,41 @@ ModelData::ComputeLumpedMass(nimble::DataManager& data_manager)
         });
 
     // SCATTER TO NODE DATA
+#ifndef KOKKOS_ENABLE_QTHREADS
+    ScatterScalarNodeDataUsingKokkosScatterView(
+        num_elem_in_block, num_nodes_per_elem, elem_conn_d, gathered_lumped_mass_block_d, lumped_mass_scatter_d);
+#else
     ScatterScalarNodeData(
         field_ids_.lumped_mass, num_elem_in_block, num_nodes_per_elem, elem_conn_d, gathered_lumped_mass_block_d);
+#endif
 
-    double block_critical_time_step =
-        block.ComputeCriticalTimeStep(reference_coordinate, displacement, num_elem_in_block, elem_conn);
+    // CRITICAL TIME STEP
+    double block_critical_time_step = std::numeric_limits<double>::max();
+    Kokkos::parallel_reduce(
+        "Critical Time Step",
+        num_elem_in_block,
+        KOKKOS_LAMBDA(const int i_elem, double& min_time_step) {
+          auto element_reference_coordinate_d =
+              Kokkos::subview(gathered_reference_coordinate_block_d, i_elem, Kokkos::ALL, Kokkos::ALL);
+          auto element_displacement_d =
+              Kokkos::subview(gathered_displacement_block_d, i_elem, Kokkos::ALL, Kokkos::ALL);
+          double elem_critical_time_step =
+              element_d->ComputeCharacteristicLength(element_reference_coordinate_d, element_displacement_d) /
+              sound_speed;
+          if (elem_critical_time_step < min_time_step) { min_time_step = elem_critical_time_step; }
+        },
+        Kokkos::Min<double>(block_critical_time_step));
     if (block_critical_time_step < critical_time_step_) { critical_time_step_ = block_critical_time_step; }
 
     block_index += 1;
   }
+#ifndef KOKKOS_ENABLE_QTHREADS
+  Kokkos::Experimental::contribute(lumped_mass_d, lumped_mass_scatter_d);
+#endif
   Kokkos::deep_copy(lumped_mass_h, lumped_mass_d);
 
-  // MPI vector reduction on lumped mass
-  std::vector<double> mpi_scalar_buffer(num_nodes);
-  for (unsigned int i = 0; i < num_nodes; i++) { mpi_scalar_buffer[i] = lumped_mass_h(i); }
-  vector_communicator->VectorReduction(1, mpi_scalar_buffer.data());
-  for (int i = 0; i < num_nodes; i++) { lumped_mass_h(i) = mpi_scalar_buffer[i]; }
+  // MPI vector reduction on lumped mass, in place on the contiguous host view
+  vector_communicator->VectorReduction(1, lumped_mass_h.data());
 }
 
 void
@@ -1117,18 +1200,59 @@ ModelData::ComputeInternalForce(
   // It may need to be updated for quasi-static simulations
   //
 
+  AssembleInternalForce(data_manager, time_previous, time_current, is_output_step);
+
+  const auto&                         field_ids        = data_manager.GetFieldIDs();
+  nimble_kokkos::HostVectorNodeView   internal_force_h = GetHostVectorNodeData(field_ids.internal_force);
+  nimble_kokkos::DeviceVectorNodeView internal_force_d = GetDeviceVectorNodeData(field_ids.internal_force);
+  Kokkos::deep_copy(internal_force_h, internal_force_d);
+
+  constexpr int mpi_vector_dim       = 3;
+  auto          myVectorCommunicator = data_manager.GetVectorCommunicator();
+  myVectorCommunicator->VectorReduction(mpi_vector_dim, internal_force_h);
+}
+
+void
+ModelData::ComputeInternalForceOnDevice(
+    nimble::DataManager& data_manager,
+    double               time_previous,
+    double               time_current,
+    bool                 is_output_step)
+{
+  AssembleInternalForce(data_manager, time_previous, time_current, is_output_step);
+
+  // The reduction across ranks works on host buffers
+  if (data_manager.GetParser().GetNumRanks() > 1) {
+    const auto&                         field_ids        = data_manager.GetFieldIDs();
+    nimble_kokkos::HostVectorNodeView   internal_force_h = GetHostVectorNodeData(field_ids.internal_force);
+    nimble_kokkos::DeviceVectorNodeView internal_force_d = GetDeviceVectorNodeData(field_ids.internal_force);
+    Kokkos::deep_copy(internal_force_h, internal_force_d);
+    constexpr int mpi_vector_dim       = 3;
+    auto          myVectorCommunicator = data_manager.GetVectorCommunicator();
+    myVectorCommunicator->VectorReduction(mpi_vector_dim, internal_force_h);
+    Kokkos::deep_copy(internal_force_d, internal_force_h);
+  }
+}
+
+void
+ModelData::AssembleInternalForce(
+    nimble::DataManager& data_manager,
+    double               time_previous,
+    double               time_current,
+    bool                 is_output_step)
+{
   const auto& mesh      = data_manager.GetMesh();
   const auto& field_ids = data_manager.GetFieldIDs();
 
   auto block_material_interface_factory = data_manager.GetBlockMaterialInterfaceFactory();
 
-  nimble_kokkos::DeviceVectorNodeView internal_force_h = GetHostVectorNodeData(field_ids.internal_force);
   nimble_kokkos::DeviceVectorNodeView internal_force_d = GetDeviceVectorNodeData(field_ids.internal_force);
   Kokkos::deep_copy(internal_force_d, (double)(0.0));
+#ifndef KOKKOS_ENABLE_QTHREADS
+  auto internal_force_scatter_d = GetDeviceVectorNodeScatterView(field_ids.internal_force);
+#endif
 
   // Compute element-level kinematics
-  constexpr int mpi_vector_dim = 3;
-
   int block_index = 0;
   for (auto& block_it : blocks_) {
     //
@@ -1220,16 +1344,20 @@ ModelData::ComputeInternalForce(
               element_internal_force_d);
         });
 
+#ifndef KOKKOS_ENABLE_QTHREADS
+    ScatterVectorNodeDataUsingKokkosScatterView(
+        num_elem_in_block, num_nodes_per_elem, elem_conn_d, gathered_internal_force_block_d, internal_force_scatter_d);
+#else
     ScatterVectorNodeData(
         field_ids.internal_force, num_elem_in_block, num_nodes_per_elem, elem_conn_d, gathered_internal_force_block_d);
+#endif
 
     block_index += 1;
   }  // loop over blocks
 
-  Kokkos::deep_copy(internal_force_h, internal_force_d);
-
-  auto myVectorCommunicator = data_manager.GetVectorCommunicator();
-  myVectorCommunicator->VectorReduction(mpi_vector_dim, internal_force_h);
+#ifndef KOKKOS_ENABLE_QTHREADS
+  Kokkos::Experimental::contribute(internal_force_d, internal_force_scatter_d);
+#endif
 }
 
 void
@@ -1553,6 +1681,15 @@ ModelData::GetDeviceFullTensorElementData(int block_id, int field_id)
   return derived_field_ptr->data();
 }
 
+DeviceStateVariableIntPtView
+ModelData::GetDeviceStateVariableData(int block_id, nimble::Step step)
+{
+  auto& state_variables_d = (step == nimble::STEP_N) ? state_variables_step_n_d_ : state_variables_step_np1_d_;
+  auto  it                = state_variables_d.find(block_id);
+  if (it == state_variables_d.end()) { return DeviceStateVariableIntPtView(); }
+  return it->second;
+}
+
 DeviceScalarNodeGatheredView
 ModelData::GatherScalarNodeData(
     int                                  field_id,
@@ -1666,6 +1803,57 @@ ModelData::ScatterScalarNodeDataUsingKokkosScatterView(
       });
   Kokkos::Experimental::contribute(data, scatter_view);
 }
+
+void
+ModelData::ScatterScalarNodeDataUsingKokkosScatterView(
+    int                                  num_elements,
+    int                                  num_nodes_per_element,
+    const DeviceElementConnectivityView& elem_conn_d,
+    const DeviceScalarNodeGatheredView&  gathered_view_d,
+    DeviceScalarNodeScatterView&         scatter_view_d)
+{
+  auto scatter_view = scatter_view_d;
+  Kokkos::parallel_for(
+      "ScatterScalarNodeData", num_elements, KOKKOS_LAMBDA(const int i_elem) {
+        auto scattered_access = scatter_view.access();
+        for (int i_node = 0; i_node < num_nodes_per_element; i_node++) {
+          scattered_access(elem_conn_d(num_nodes_per_element * i_elem + i_node)) += gathered_view_d(i_elem, i_node);
+        }
+      });
+}
+
+void
+ModelData::ScatterVectorNodeDataUsingKokkosScatterView(
+    int                                  num_elements,
+    int                                  num_nodes_per_element,
+    const DeviceElementConnectivityView& elem_conn_d,
+    const DeviceVectorNodeGatheredView&  gathered_view_d,
+    DeviceVectorNodeScatterView&         scatter_view_d)
+{
+  auto scatter_view = scatter_view_d;
+  Kokkos::parallel_for(
+      "ScatterVectorNodeData", num_elements, KOKKOS_LAMBDA(const int i_elem) {
+        auto scattered_access = scatter_view.access();
+        for (int i_node = 0; i_node < num_nodes_per_element; i_node++) {
+          int node_index = elem_conn_d(num_nodes_per_element * i_elem + i_node);
+          for (int i_coord = 0; i_coord < 3; i_coord++) {
+            scattered_access(node_index, i_coord) += gathered_view_d(i_elem, i_node, i_coord);
+          }
+        }
+      });
+}
+
+DeviceVectorNodeScatterView
+ModelData::GetDeviceVectorNodeScatterView(int field_id)
+{
+  auto it = vector_node_scatter_views_d_.find(field_id);
+  if (it == vector_node_scatter_views_d_.end()) {
+    auto data = GetDeviceVectorNodeData(field_id);
+    it        = vector_node_scatter_views_d_.emplace(field_id, Kokkos::Experimental::create_scatter_view(data)).first;
+  }
+  it->second.reset();
+  return it->second;
+}
 #endif
 
 void
@@ -1680,4 +1868,109 @@ ModelData::UpdateWithNewDisplacement(nimble::DataManager& data_manager, double d
   Kokkos::deep_copy(displacement_d_, displacement_h_);
 }
 
+void
+ModelData::ApplyKinematicConditionsOnDevice(nimble::DataManager& data_manager, double time_current, double time_previous)
+{
+  if (!kinematic_bc_initialized_ || kinematic_bc_has_expression_) {
+    auto                bc                   = data_manager.GetBoundaryConditionManager();
+    auto                reference_coordinate = GetVectorNodeData("reference_coordinate");
+    std::vector<int>    node_ids, coordinates, is_displacement;
+    std::vector<double> values;
+    bc->GetKinematicBCEntries(time_current, reference_coordinate, node_ids, coordinates, is_displacement, values);
+    int num_entries = static_cast<int>(node_ids.size());
+    if (!kinematic_bc_initialized_) {
+      kinematic_bc_has_expression_     = bc->HasKinematicBCExpression();
+      kinematic_bc_node_ids_d_         = DeviceIntegerArrayView("kinematic_bc_node_ids_d", num_entries);
+      kinematic_bc_coordinates_d_      = DeviceIntegerArrayView("kinematic_bc_coordinates_d", num_entries);
+      kinematic_bc_is_displacement_d_  = DeviceIntegerArrayView("kinematic_bc_is_displacement_d", num_entries);
+      kinematic_bc_values_d_           = DeviceScalarNodeView("kinematic_bc_values_d", num_entries);
+      kinematic_bc_values_h_           = Kokkos::create_mirror_view(kinematic_bc_values_d_);
+      HostIntegerArrayView node_ids_h("kinematic_bc_node_ids_h", num_entries);
+      HostIntegerArrayView coordinates_h("kinematic_bc_coordinates_h", num_entries);
+      HostIntegerArrayView is_displacement_h("kinematic_bc_is_displacement_h", num_entries);
+      for (int i = 0; i < num_entries; ++i) {
+        node_ids_h(i)        = node_ids[i];
+        coordinates_h(i)     = coordinates[i];
+        is_displacement_h(i) = is_displacement[i];
+      }
+      Kokkos::deep_copy(kinematic_bc_node_ids_d_, node_ids_h);
+      Kokkos::deep_copy(kinematic_bc_coordinates_d_, coordinates_h);
+      Kokkos::deep_copy(kinematic_bc_is_displacement_d_, is_displacement_h);
+      kinematic_bc_initialized_ = true;
+    }
+    for (int i = 0; i < num_entries; ++i) { kinematic_bc_values_h_(i) = values[i]; }
+    Kokkos::deep_copy(kinematic_bc_values_d_, kinematic_bc_values_h_);
+  }
+
+  const auto&  field_ids       = data_manager.GetFieldIDs();
+  auto         displacement_d  = GetDeviceVectorNodeData(field_ids.displacement);
+  auto         velocity_d      = GetDeviceVectorNodeData(field_ids.velocity);
+  auto         node_ids_d      = kinematic_bc_node_ids_d_;
+  auto         coordinates_d   = kinematic_bc_coordinates_d_;
+  auto         is_displacement = kinematic_bc_is_displacement_d_;
+  auto         values_d        = kinematic_bc_values_d_;
+  const double delta_t         = time_current - time_previous;
+  Kokkos::parallel_for(
+      "Kinematic Conditions", static_cast<int>(node_ids_d.extent(0)), KOKKOS_LAMBDA(const int i) {
+        const int n = node_ids_d(i);
+        const int c = coordinates_d(i);
+        if (is_displacement(i) == 0) {
+          velocity_d(n, c) = values_d(i);
+        } else if (delta_t > 0.0) {
+          velocity_d(n, c) = (values_d(i) - displacement_d(n, c)) / delta_t;
+        }
+      });
+}
+
+void
+ModelData::AxpyVectorNodeDataOnDevice(int field_id, double scale, int increment_field_id)
+{
+  auto y_d = GetDeviceVectorNodeData(field_id);
+  auto x_d = GetDeviceVectorNodeData(increment_field_id);
+  Kokkos::parallel_for(
+      "Axpy Vector Node Data", static_cast<int>(y_d.extent(0)), KOKKOS_LAMBDA(const int i) {
+        for (int j = 0; j < 3; ++j) { y_d(i, j) += scale * x_d(i, j); }
+      });
+}
+
+void
+ModelData::ComputeAccelerationOnDevice(nimble::DataManager& data_manager, bool include_contact_force)
+{
+  const auto& field_ids        = data_manager.GetFieldIDs();
+  auto        lumped_mass_d    = GetDeviceScalarNodeData(field_ids.lumped_mass);
+  auto        internal_force_d = GetDeviceVectorNodeData(field_ids.internal_force);
+  auto        external_force_d = GetDeviceVectorNodeData(field_ids.external_force);
+  auto        acceleration_d   = GetDeviceVectorNodeData(field_ids.acceleration);
+  if (include_contact_force) {
+    auto contact_force_d = GetDeviceVectorNodeData(field_ids.contact_force);
+    Kokkos::parallel_for(
+        "Acceleration", static_cast<int>(acceleration_d.extent(0)), KOKKOS_LAMBDA(const int i) {
+          const double oneOverM = 1.0 / lumped_mass_d(i);
+          for (int j = 0; j < 3; ++j) {
+            acceleration_d(i, j) = oneOverM * (internal_force_d(i, j) + external_force_d(i, j) + contact_force_d(i, j));
+          }
+        });
+  } else {
+    Kokkos::parallel_for(
+        "Acceleration", static_cast<int>(acceleration_d.extent(0)), KOKKOS_LAMBDA(const int i) {
+          const double oneOverM = 1.0 / lumped_mass_d(i);
+          for (int j = 0; j < 3; ++j) {
+            acceleration_d(i, j) = oneOverM * (internal_force_d(i, j) + external_force_d(i, j));
+          }
+        });
+  }
+}
+
+void
+ModelData::CopyVectorNodeDataToHost(int field_id)
+{
+  Kokkos::deep_copy(GetHostVectorNodeData(field_id), GetDeviceVectorNodeData(field_id));
+}
+
+void
+ModelData::CopyVectorNodeDataToDevice(int field_id)
+{
+  Kokkos::deep_copy(GetDeviceVectorNodeData(field_id), GetHostVectorNodeData(field_id));
+}
+
 }  // namespace nimble_kokkos
@@ -174,6 +174,58 @@ class ModelData : public nimble::ModelDataBase
   void
   UpdateWithNewDisplacement(nimble::DataManager& data_manager, double dt) override;
 
+  //--- Device-resident explicit time stepping
+
+  /// \brief Compute the internal force and keep it on the device
+  ///
+  /// \param[in] data_manager
+  /// \param[in] time_previous
+  /// \param[in] time_current
+  /// \param[in] is_output_step
+  ///
+  /// \note The host mirror of the internal force is only updated when the
+  ///       MPI reduction needs it.
+  void
+  ComputeInternalForceOnDevice(
+      nimble::DataManager& data_manager,
+      double               time_previous,
+      double               time_current,
+      bool                 is_output_step);
+
+  /// \brief Apply the kinematic conditions to the device velocity
+  ///
+  /// \param[in] data_manager Reference to the data manager
+  /// \param[in] time_current
+  /// \param[in] time_previous
+  ///
+  /// \note Only the prescribed values cross from the host, and only when they
+  ///       depend on an expression.
+  void
+  ApplyKinematicConditionsOnDevice(nimble::DataManager& data_manager, double time_current, double time_previous);
+
+  /// \brief Add a multiple of a vector node field to another on the device
+  ///
+  /// \param[in] field_id Field updated in place
+  /// \param[in] scale Scaling factor
+  /// \param[in] increment_field_id Field added to field_id
+  void
+  AxpyVectorNodeDataOnDevice(int field_id, double scale, int increment_field_id);
+
+  /// \brief Compute the acceleration from the node forces on the device
+  ///
+  /// \param[in] data_manager Reference to the data manager
+  /// \param[in] include_contact_force Add the contact force to the internal and external forces
+  void
+  ComputeAccelerationOnDevice(nimble::DataManager& data_manager, bool include_contact_force);
+
+  /// \brief Copy a vector node field from the device to the host
+  void
+  CopyVectorNodeDataToHost(int field_id);
+
+  /// \brief Copy a vector node field from the host to the device
+  void
+  CopyVectorNodeDataToDevice(int field_id);
+
   //--- Specific routines
 
   int
@@ -244,6 +296,14 @@ class ModelData : public nimble::ModelDataBase
   DeviceFullTensorElemView
   GetDeviceFullTensorElementData(int block_id, int field_id);
 
+  /// \brief Get the material state variables of a block
+  ///
+  /// \param block_id Block ID
+  /// \param step Time state (n or n+1)
+  /// \return View (elem, ipt, state_variable_index), empty when the material has no state
+  DeviceStateVariableIntPtView
+  GetDeviceStateVariableData(int block_id, nimble::Step step);
+
   DeviceScalarNodeGatheredView
   GatherScalarNodeData(
       int                                  field_id,
@@ -284,6 +344,40 @@ class ModelData : public nimble::ModelDataBase
       int                                  num_nodes_per_element,
       const DeviceElementConnectivityView& elem_conn_d,
       const DeviceScalarNodeGatheredView&  gathered_view_d);
+
+  /// \brief Accumulate gathered element data into a scatter view
+  ///
+  /// \note The caller resets the scatter view before the first block and
+  /// contributes it to the node field after the last one.
+  void
+  ScatterScalarNodeDataUsingKokkosScatterView(
+      int                                  num_elements,
+      int                                  num_nodes_per_element,
+      const DeviceElementConnectivityView& elem_conn_d,
+      const DeviceScalarNodeGatheredView&  gathered_view_d,
+      DeviceScalarNodeScatterView&         scatter_view_d);
+
+  /// \brief Accumulate gathered element data into a scatter view
+  ///
+  /// \note The caller resets the scatter view before the first block and
+  /// contributes it to the node field after the last one.
+  void
+  ScatterVectorNodeDataUsingKokkosScatterView(
+      int                                  num_elements,
+      int                                  num_nodes_per_element,
+      const DeviceElementConnectivityView& elem_conn_d,
+      const DeviceVectorNodeGatheredView&  gathered_view_d,
+      DeviceVectorNodeScatterView&         scatter_view_d);
+
+  /// \brief Get the scatter view of a vector node field, reset to zero
+  ///
+  /// \param field_id the field id (see DataManager::GetFieldIDs())
+  /// \return Scatter view allocated on first use and kept for later steps
+  ///
+  /// \note On backends without duplication the scatter view aliases the field,
+  /// so resetting it also zeroes the field.
+  DeviceVectorNodeScatterView
+  GetDeviceVectorNodeScatterView(int field_id);
 #endif
 
  protected:
@@ -296,6 +390,14 @@ class ModelData : public nimble::ModelDataBase
   void
   InitializeBlockData(nimble::DataManager& data_manager);
 
+  /// \brief Assemble the internal force on the device, without MPI reduction
+  void
+  AssembleInternalForce(
+      nimble::DataManager& data_manager,
+      double               time_previous,
+      double               time_current,
+      bool                 is_output_step);
+
  protected:
   using Data = std::unique_ptr<FieldBase>;
 
@@ -331,6 +433,11 @@ class ModelData : public nimble::ModelDataBase
   std::vector<nimble_kokkos::DeviceVectorNodeGatheredView> gathered_internal_force_d;
   std::vector<nimble_kokkos::DeviceVectorNodeGatheredView> gathered_contact_force_d;
 
+#ifndef KOKKOS_ENABLE_QTHREADS
+  //--- Scatter views for node data assembled every step, keyed by field ID
+  std::map<int, nimble_kokkos::DeviceVectorNodeScatterView> vector_node_scatter_views_d_;
+#endif
+
   //--- Data for Exodus output
   nimble_kokkos::HostVectorNodeView   displacement_h_;
   nimble_kokkos::DeviceVectorNodeView displacement_d_;
@@ -338,8 +445,21 @@ class ModelData : public nimble::ModelDataBase
   nimble_kokkos::HostVectorNodeView   velocity_h_;
   nimble_kokkos::DeviceVectorNodeView velocity_d_;
 
+  //--- Kinematic conditions flattened for ApplyKinematicConditionsOnDevice()
+  bool                                  kinematic_bc_initialized_{false};
+  bool                                  kinematic_bc_has_expression_{false};
+  nimble_kokkos::DeviceIntegerArrayView kinematic_bc_node_ids_d_;
+  nimble_kokkos::DeviceIntegerArrayView kinematic_bc_coordinates_d_;
+  nimble_kokkos::DeviceIntegerArrayView kinematic_bc_is_displacement_d_;
+  nimble_kokkos::DeviceScalarNodeView   kinematic_bc_values_d_;
+  nimble_kokkos::HostScalarNodeView     kinematic_bc_values_h_;
+
   //--- Block data for materials
   std::vector<nimble::BlockData> block_data_;
+
+  //--- Material state variables per block, time states are swapped in UpdateStates()
+  std::map<int, DeviceStateVariableIntPtView> state_variables_step_n_d_;
+  std::map<int, DeviceStateVariableIntPtView> state_variables_step_np1_d_;
 };
 
 }  // namespace nimble_kokkos
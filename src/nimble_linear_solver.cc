@@ -47,6 +47,7 @@
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include "nimble_macros.h"
@@ -76,6 +77,19 @@ CRSMatrixContainer::AllocateNonzeros(std::vector<int> const& i_index, std::vecto
   row_first_index_[num_rows_] = i_index_.size();
 }
 
+void
+CRSMatrixContainer::AllocateRowStructure(std::vector<int>&& row_first_index, std::vector<int>&& j_index)
+{
+  row_first_index_ = std::move(row_first_index);
+  j_index_         = std::move(j_index);
+  num_rows_        = static_cast<int>(row_first_index_.size()) - 1;
+  data_.assign(j_index_.size(), 0.0);
+  i_index_.resize(j_index_.size());
+  for (int i_row = 0; i_row < num_rows_; i_row++) {
+    for (int i = row_first_index_[i_row]; i < row_first_index_[i_row + 1]; i++) { i_index_[i] = i_row; }
+  }
+}
+
 void
 CRSMatrixContainer::SetRowValues(int row, double value)
 {
@@ -286,7 +300,7 @@ CG_SolveSystem(
 
   // diagonal preconditioner
   CRSMatrixContainer& M = cg_scratch.M;
-  PopulateDiagonalPreconditioner(A, M);
+  if (!cg_scratch.keep_preconditioner) { PopulateDiagonalPreconditioner(A, M); }
 
   // r = b - Ax
   A.MatVec(x, q);
@@ -345,4 +359,42 @@ CG_SolveSystem(
   return success;
 }
 
+bool
+LimitedMemoryBFGS::AddPair(const std::vector<double>& s, const std::vector<double>& y)
+{
+  double ys = InnerProduct(y, s);
+  if (ys <= 0.0) { return false; }
+  if (static_cast<int>(s_.size()) == max_num_pairs_) {
+    s_.erase(s_.begin());
+    y_.erase(y_.begin());
+    rho_.erase(rho_.begin());
+  }
+  s_.push_back(s);
+  y_.push_back(y);
+  rho_.push_back(1.0 / ys);
+  return true;
+}
+
+void
+LimitedMemoryBFGS::ApplyFirstLoop(std::vector<double>& q)
+{
+  // see Nocedal and Wright, "Numerical Optimization", Algorithm 7.4
+  int num_pairs = NumPairs();
+  alpha_.resize(num_pairs);
+  for (int k = num_pairs - 1; k >= 0; k--) {
+    alpha_[k] = rho_[k] * InnerProduct(s_[k], q);
+    for (unsigned int i = 0; i < q.size(); i++) { q[i] -= alpha_[k] * y_[k][i]; }
+  }
+}
+
+void
+LimitedMemoryBFGS::ApplySecondLoop(std::vector<double>& z) const
+{
+  int num_pairs = NumPairs();
+  for (int k = 0; k < num_pairs; k++) {
+    double beta = rho_[k] * InnerProduct(y_[k], z);
+    for (unsigned int i = 0; i < z.size(); i++) { z[i] += (alpha_[k] - beta) * s_[k][i]; }
+  }
+}
+
 }  // namespace nimble
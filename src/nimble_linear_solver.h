@@ -125,6 +125,13 @@ class CRSMatrixContainer
   void
   AllocateNonzeros(std::vector<int> const& i_index, std::vector<int> const& j_index);
 
+  /// \brief Allocate from a compressed row structure, taking ownership of the index arrays
+  ///
+  /// \param row_first_index Offset of the first nonzero of each row (num_rows + 1 entries)
+  /// \param j_index Sorted column index of each nonzero
+  void
+  AllocateRowStructure(std::vector<int>&& row_first_index, std::vector<int>&& j_index);
+
   void
   AllocateDiagonalMatrix(int num_rows)
   {
@@ -148,6 +155,12 @@ class CRSMatrixContainer
     for (double& d_data : data_) d_data = value;
   }
 
+  void
+  ScaleAllValues(double factor)
+  {
+    for (double& d_data : data_) d_data *= factor;
+  }
+
   void
   SetRowValues(int row, double value);
 
@@ -240,13 +253,14 @@ LU_SolveSystem(int num_entries, MatrixContainer& mat, double* vec, int* scratch)
 
 struct CGScratchSpace
 {
-  CGScratchSpace() : len_(0) {}
+  CGScratchSpace() : len_(0), keep_preconditioner(false) {}
 
   void
   Resize(int len)
   {
     if (len != len_) {
-      len_ = len;
+      len_                = len;
+      keep_preconditioner = false;
       d.resize(len_);
       r.resize(len_);
       s.resize(len_);
@@ -261,6 +275,9 @@ struct CGScratchSpace
   std::vector<double> s;
   std::vector<double> q;
   CRSMatrixContainer  M;
+
+  //! When true, CG_SolveSystem reuses the preconditioner M from the previous solve
+  bool keep_preconditioner;
 };
 
 bool
@@ -273,6 +290,113 @@ CG_SolveSystem(
     double                      cg_tol = 1.0e-16,
     int                         max_iterations = 1000);
 
+/// \brief Limited-memory BFGS approximation of the inverse of a matrix
+///
+/// The approximation H is built from a reference inverse H0 and from pairs
+/// (s, y) with y ~ A s. The product H r is evaluated with the two-loop
+/// recursion, where the application of H0 is left to the caller:
+///
+///   q = r; bfgs.ApplyFirstLoop(q); z = H0 q; bfgs.ApplySecondLoop(z); // z = H r
+class LimitedMemoryBFGS
+{
+ public:
+  explicit LimitedMemoryBFGS(int max_num_pairs = 10) : max_num_pairs_(max_num_pairs) {}
+
+  void
+  Clear()
+  {
+    s_.clear();
+    y_.clear();
+    rho_.clear();
+  }
+
+  int
+  NumPairs() const
+  {
+    return static_cast<int>(s_.size());
+  }
+
+  /// \brief Store a new pair, the oldest pair is dropped when the storage is full
+  ///
+  /// \return False when the pair violates the curvature condition y^T s > 0 and is skipped
+  bool
+  AddPair(const std::vector<double>& s, const std::vector<double>& y);
+
+  void
+  ApplyFirstLoop(std::vector<double>& q);
+
+  void
+  ApplySecondLoop(std::vector<double>& z) const;
+
+ private:
+  int                              max_num_pairs_;
+  std::vector<std::vector<double>> s_;
+  std::vector<std::vector<double>> y_;
+  std::vector<double>              rho_;
+  std::vector<double>              alpha_;
+};
+
+/// \brief Decides when the nonlinear solver reassembles the tangent stiffness
+///
+/// Full Newton assembles the tangent at every iteration. Modified Newton and
+/// BFGS keep it until it has been used for the refresh interval, until an
+/// iteration reduces the residual by less than the refresh ratio, or until the
+/// tangent is invalidated (e.g. by a change of the time step, or when the
+/// linear solve fails with the stored tangent).
+class TangentRefreshPolicy
+{
+ public:
+  TangentRefreshPolicy(bool keep_tangent, int refresh_interval, double refresh_ratio)
+      : keep_tangent_(keep_tangent), refresh_interval_(refresh_interval), refresh_ratio_(refresh_ratio)
+  {
+  }
+
+  bool
+  NeedsAssembly() const
+  {
+    if (!keep_tangent_ || !is_current_) return true;
+    return (iterations_since_refresh_ >= refresh_interval_) || slow_convergence_;
+  }
+
+  void
+  Invalidate()
+  {
+    is_current_ = false;
+  }
+
+  void
+  Assembled()
+  {
+    is_current_               = true;
+    slow_convergence_         = false;
+    iterations_since_refresh_ = 0;
+    num_assemblies_ += 1;
+  }
+
+  /// \brief Record the residual norms before and after a nonlinear iteration
+  void
+  Iterated(double residual_before, double residual_after)
+  {
+    iterations_since_refresh_ += 1;
+    slow_convergence_ = (residual_after > refresh_ratio_ * residual_before);
+  }
+
+  int
+  NumAssemblies() const
+  {
+    return num_assemblies_;
+  }
+
+ private:
+  bool   keep_tangent_;
+  int    refresh_interval_;
+  double refresh_ratio_;
+  bool   is_current_               = false;
+  bool   slow_convergence_         = false;
+  int    iterations_since_refresh_ = 0;
+  int    num_assemblies_           = 0;
+};
+
 }  // namespace nimble
 
 #endif
@@ -62,6 +62,15 @@
 #include "nimble_version.h"
 #include "nimble_view.h"
 
+#ifdef NIMBLE_HAVE_KOKKOS
+#include "nimble_kokkos_model_data.h"
+#endif
+
+#ifdef NIMBLE_HAVE_UQ
+#include "uq/nimble_uq.h"
+#include "uq/nimble_uq_model_data.h"
+#endif
+
 #ifdef NIMBLE_HAVE_MPI
 #include <mpi.h>
 #endif
@@ -76,6 +85,7 @@
 
 #include <cmath>
 #include <fstream>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <limits>
@@ -136,6 +146,248 @@ parseCommandLine(int argc, char** argv, nimble::EnvironmentFlags& myFlags)
 
 namespace details {
 
+/// \brief Newmark / HHT-alpha data for the "implicit dynamics" scheme
+///
+/// The displacement at step n+1 is the unknown of the Newton iterations.
+/// The velocity and acceleration follow from the Newmark relations
+/// with beta = (1 - alpha)^2 / 4 and gamma = (1 - 2 alpha) / 2.
+/// Vectors are stored node by node, at index (node * dim + dof).
+struct NewmarkData
+{
+  void
+  Initialize(double hht_alpha, double damping, int num_nodes, int dimension)
+  {
+    alpha        = hht_alpha;
+    beta         = 0.25 * (1.0 - alpha) * (1.0 - alpha);
+    gamma        = 0.5 - alpha;
+    mass_damping = damping;
+    dim          = dimension;
+    lumped_mass.assign(num_nodes, 0.0);
+    free_dof.assign(num_nodes * dim, 1.0);
+    displacement_n.assign(num_nodes * dim, 0.0);
+    velocity_n.assign(num_nodes * dim, 0.0);
+    acceleration_n.assign(num_nodes * dim, 0.0);
+    internal_force_n.assign(num_nodes * dim, 0.0);
+  }
+
+  /// \brief Store the state at time n and set the predictor U^{n+1} = U^{n} + dt V^{n} + dt^2/2 A^{n}
+  ///
+  /// \note The predictor is not applied to the dof with kinematic BC.
+  void
+  BeginStep(
+      double                    dt,
+      nimble::Viewify<2>&       displacement,
+      const nimble::Viewify<2>& velocity,
+      const nimble::Viewify<2>& acceleration,
+      const nimble::Viewify<2>& internal_force)
+  {
+    delta_time = dt;
+    for (int n = 0; n < static_cast<int>(lumped_mass.size()); n++) {
+      for (int dof = 0; dof < dim; dof++) {
+        int i               = n * dim + dof;
+        displacement_n[i]   = displacement(n, dof);
+        velocity_n[i]       = velocity(n, dof);
+        acceleration_n[i]   = acceleration(n, dof);
+        internal_force_n[i] = internal_force(n, dof);
+        displacement(n, dof) += free_dof[i] * (dt * velocity_n[i] + 0.5 * dt * dt * acceleration_n[i]);
+      }
+    }
+  }
+
+  /// \brief Reset the fields to their values at time n
+  void
+  RestoreStep(
+      nimble::Viewify<2>& displacement,
+      nimble::Viewify<2>& velocity,
+      nimble::Viewify<2>& acceleration,
+      nimble::Viewify<2>& internal_force) const
+  {
+    for (int n = 0; n < static_cast<int>(lumped_mass.size()); n++) {
+      for (int dof = 0; dof < dim; dof++) {
+        int i                  = n * dim + dof;
+        displacement(n, dof)   = displacement_n[i];
+        velocity(n, dof)       = velocity_n[i];
+        acceleration(n, dof)   = acceleration_n[i];
+        internal_force(n, dof) = internal_force_n[i];
+      }
+    }
+  }
+
+  /// \brief Set the velocity and acceleration from the converged displacement
+  void
+  EndStep(const nimble::Viewify<2>& displacement, nimble::Viewify<2>& velocity, nimble::Viewify<2>& acceleration)
+      const
+  {
+    for (int n = 0; n < static_cast<int>(lumped_mass.size()); n++) {
+      for (int dof = 0; dof < dim; dof++) {
+        int    i             = n * dim + dof;
+        double a             = Acceleration(i, displacement(n, dof));
+        acceleration(n, dof) = a;
+        velocity(n, dof)     = Velocity(i, a);
+      }
+    }
+  }
+
+  double
+  Acceleration(int i, double u) const
+  {
+    return (u - displacement_n[i] - delta_time * velocity_n[i]) / (beta * delta_time * delta_time) -
+           (0.5 / beta - 1.0) * acceleration_n[i];
+  }
+
+  double
+  Velocity(int i, double a) const
+  {
+    return velocity_n[i] + delta_time * ((1.0 - gamma) * acceleration_n[i] + gamma * a);
+  }
+
+  /// \brief Add the inertial and damping forces to the residual R = -F
+  ///
+  /// R = -(1 + alpha) F^{n+1} + alpha F^{n} + M A^{n+1} + c M ((1 + alpha) V^{n+1} - alpha V^{n})
+  void
+  AddInertialResidual(
+      const nimble::Viewify<2>& displacement,
+      const nimble::Viewify<2>& internal_force,
+      const int*                linear_system_node_ids,
+      double*                   residual_vector) const
+  {
+    for (int n = 0; n < static_cast<int>(lumped_mass.size()); n++) {
+      for (int dof = 0; dof < dim; dof++) {
+        int    i = n * dim + dof;
+        double a = Acceleration(i, displacement(n, dof));
+        double v = Velocity(i, a);
+        residual_vector[linear_system_node_ids[n] * dim + dof] +=
+            -alpha * (internal_force(n, dof) - internal_force_n[i]) + lumped_mass[n] * a +
+            mass_damping * lumped_mass[n] * ((1.0 + alpha) * v - alpha * velocity_n[i]);
+      }
+    }
+  }
+
+  /// \brief Turn K into the effective stiffness (1 + alpha) K + (1 + c (1 + alpha) gamma dt) M / (beta dt^2)
+  template <typename MatT>
+  void
+  AddInertialTangent(const std::vector<int>& linear_system_node_ids, MatT& tangent_stiffness) const
+  {
+    tangent_stiffness.ScaleAllValues(1.0 + alpha);
+    double factor = (1.0 + mass_damping * (1.0 + alpha) * gamma * delta_time) / (beta * delta_time * delta_time);
+    for (int n = 0; n < static_cast<int>(lumped_mass.size()); n++) {
+      for (int dof = 0; dof < dim; dof++) {
+        int ls_index = linear_system_node_ids[n] * dim + dof;
+        tangent_stiffness(ls_index, ls_index) += factor * lumped_mass[n];
+      }
+    }
+  }
+
+  double              alpha{0.0};
+  double              beta{0.25};
+  double              gamma{0.5};
+  double              mass_damping{0.0};
+  double              delta_time{0.0};
+  int                 dim{3};
+  std::vector<double> lumped_mass;
+  std::vector<double> free_dof;
+  std::vector<double> displacement_n;
+  std::vector<double> velocity_n;
+  std::vector<double> acceleration_n;
+  std::vector<double> internal_force_n;
+};
+
+/// \brief Flat map between the nodal fields and the linear system vectors
+///
+/// Entry i = (node * dim + dof) of a nodal field maps to the linear system
+/// index ls_index[i]. The permutation lists the nodal entries with the free
+/// dof first and the dof with kinematic BC last, so the constrained dof are
+/// visited without scanning the node sets again.
+///
+/// \note The linear system keeps every dof, the rows and columns of the
+/// constrained dof are handled by ModifyTangentStiffnessMatrixForKinematicBC.
+/// Each linear system node is associated with a single mesh node.
+struct LinearSystemDofMap
+{
+  void
+  Initialize(int num_nodes, int dimension, const int* global_node_ids, const nimble::BoundaryConditionManager& bc)
+  {
+    dim = dimension;
+    linear_system_node_ids.assign(global_node_ids, global_node_ids + num_nodes);
+    ls_index.resize(num_nodes * dim);
+    for (int n = 0; n < num_nodes; n++) {
+      for (int dof = 0; dof < dim; dof++) { ls_index[n * dim + dof] = linear_system_node_ids[n] * dim + dof; }
+    }
+    // Mask with zeros on the dof with kinematic BC, indexed by local node ids
+    std::vector<int>    local_node_ids(num_nodes);
+    std::vector<double> free_dof(num_nodes * dim, 1.0);
+    for (int n = 0; n < num_nodes; n++) local_node_ids[n] = n;
+    bc.ModifyRHSForKinematicBC(local_node_ids.data(), free_dof.data());
+    permutation.clear();
+    permutation.reserve(num_nodes * dim);
+    for (int i = 0; i < num_nodes * dim; i++) {
+      if (free_dof[i] != 0.0) permutation.push_back(i);
+    }
+    num_free_dof = static_cast<int>(permutation.size());
+    for (int i = 0; i < num_nodes * dim; i++) {
+      if (free_dof[i] == 0.0) permutation.push_back(i);
+    }
+  }
+
+  /// \brief Set ls_vector = coefficient * field on every dof
+  void
+  Gather(double coefficient, const nimble::Viewify<2>& field, double* ls_vector) const
+  {
+    const int num_entries = static_cast<int>(ls_index.size());
+    auto      gather      = [&](int i) { ls_vector[ls_index[i]] = coefficient * field(i / dim, i % dim); };
+#ifdef NIMBLE_HAVE_KOKKOS
+    Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_entries), gather);
+#else
+    for (int i = 0; i < num_entries; i++) { gather(i); }
+#endif
+  }
+
+  /// \brief Set new_field = field + coefficient * ls_vector on every dof
+  void
+  Scatter(
+      double                    coefficient,
+      const double*             ls_vector,
+      const nimble::Viewify<2>& field,
+      nimble::Viewify<2>&       new_field) const
+  {
+    const int num_entries = static_cast<int>(ls_index.size());
+    auto      scatter     = [&](int i) {
+      const int n = i / dim, dof = i % dim;
+      new_field(n, dof) = field(n, dof) + coefficient * ls_vector[ls_index[i]];
+    };
+#ifdef NIMBLE_HAVE_KOKKOS
+    Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_entries), scatter);
+#else
+    for (int i = 0; i < num_entries; i++) { scatter(i); }
+#endif
+  }
+
+  /// \brief Zero the entries of a linear system vector on the dof with kinematic BC
+  void
+  ZeroConstrainedDof(double* ls_vector) const
+  {
+    const int num_entries = static_cast<int>(permutation.size());
+    for (int k = num_free_dof; k < num_entries; k++) { ls_vector[ls_index[permutation[k]]] = 0.0; }
+  }
+
+  /// \brief Copy the entries of a nodal field on the dof with kinematic BC into another nodal field
+  void
+  CopyConstrainedDof(const nimble::Viewify<2>& field, nimble::Viewify<2>& target) const
+  {
+    const int num_entries = static_cast<int>(permutation.size());
+    for (int k = num_free_dof; k < num_entries; k++) {
+      const int n = permutation[k] / dim, dof = permutation[k] % dim;
+      target(n, dof) = field(n, dof);
+    }
+  }
+
+  int              dim{3};
+  int              num_free_dof{0};
+  std::vector<int> linear_system_node_ids;
+  std::vector<int> ls_index;
+  std::vector<int> permutation;
+};
+
 int
 ExplicitTimeIntegrator(
     const nimble::Parser&                     parser,
@@ -146,19 +398,39 @@ ExplicitTimeIntegrator(
 int
 QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mesh, nimble::DataManager& data_manager);
 
+int
+DynamicRelaxationIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mesh, nimble::DataManager& data_manager);
+
+double
+ComputeDynamicRelaxationResidual(
+    nimble::DataManager&       data_manager,
+    double                     time_previous,
+    double                     time_current,
+    bool                       is_output_step,
+    const std::vector<double>& free_dof,
+    const std::vector<double>& owned_node,
+    std::vector<double>&       residual_force);
+
+void
+UpdateDisplacement(
+    const LinearSystemDofMap&  dof_map,
+    double                     coefficient,
+    const std::vector<double>& linear_solver_solution,
+    const nimble::Viewify<2>&  displacement,
+    nimble::Viewify<2>&        new_displacement);
+
 double
 ComputeQuasistaticResidual(
-    nimble::GenesisMesh&              mesh,
-    nimble::DataManager&              data_manager,
-    nimble::BoundaryConditionManager& bc,
-    int                               linear_system_num_unknowns,
-    std::vector<int>&                 linear_system_global_node_ids,
-    double                            time_previous,
-    double                            time_current,
-    const nimble::Viewify<2>&         displacement,
-    nimble::Viewify<2>&               internal_force,
-    double*                           residual_vector,
-    bool                              is_output_step);
+    nimble::GenesisMesh&      mesh,
+    nimble::DataManager&      data_manager,
+    const LinearSystemDofMap& dof_map,
+    double                    time_previous,
+    double                    time_current,
+    const nimble::Viewify<2>& displacement,
+    nimble::Viewify<2>&       internal_force,
+    double*                   residual_vector,
+    bool                      is_output_step,
+    const NewmarkData*        inertia = nullptr);
 
 int
 parseCommandLine(int argc, char** argv, nimble::Parser& parser)
@@ -170,6 +442,11 @@ parseCommandLine(int argc, char** argv, nimble::Parser& parser)
     //
     if ((my_arg == "--use_kokkos") || (my_arg == "--use_kokkos") || (my_arg == "--use_vt")) continue;
     //
+    if (my_arg == "--overlap_contact") {
+      parser.SetToOverlapContact(true);
+      continue;
+    }
+    //
     if (my_arg == "--use_uq") {
 #ifdef NIMBLE_HAVE_UQ
       parser.SetToUseUQ();
@@ -323,8 +600,10 @@ NimbleMain(
   const auto time_integration_scheme = parser.TimeIntegrationScheme();
   if (time_integration_scheme == "explicit") {
     status = details::ExplicitTimeIntegrator(parser, mesh, data_manager, contact_interface);
-  } else if (time_integration_scheme == "quasistatic") {
+  } else if (time_integration_scheme == "quasistatic" || time_integration_scheme == "implicit dynamics") {
     status = details::QuasistaticTimeIntegrator(parser, mesh, data_manager);
+  } else if (time_integration_scheme == "dynamic relaxation") {
+    status = details::DynamicRelaxationIntegrator(parser, mesh, data_manager);
   }
 
   return status;
@@ -370,8 +649,6 @@ ExplicitTimeIntegrator(
   const int  num_ranks    = parser.GetNumRanks();
   const long num_unknowns = num_nodes * mesh.GetDim();
 
-  auto contact_manager = nimble::GetContactManager(contact_interface, data_manager);
-
   bool contact_enabled       = parser.HasContact();
   bool contact_visualization = parser.ContactVisualization();
 
@@ -404,25 +681,46 @@ ExplicitTimeIntegrator(
   auto                   myVectorCommunicator = data_manager.GetVectorCommunicator();
   nimble::ProfilingTimer watch_simulation;
 
+  //
+  // One contact manager, with its own search structure, per contact interaction
+  //
+  std::vector<std::shared_ptr<nimble::ContactManager>> contact_managers;
   if (contact_enabled) {
-    std::vector<std::string> contact_primary_block_names, contact_secondary_block_names;
-    double                   penalty_parameter;
-    nimble::ParseContactCommand(
-        parser.ContactString(), contact_primary_block_names, contact_secondary_block_names, penalty_parameter);
-    std::vector<int> contact_primary_block_ids, contact_secondary_block_ids;
-    mesh.BlockNamesToOnProcessorBlockIds(contact_primary_block_names, contact_primary_block_ids);
-    mesh.BlockNamesToOnProcessorBlockIds(contact_secondary_block_names, contact_secondary_block_ids);
-    contact_manager->SetPenaltyParameter(penalty_parameter);
-    contact_manager->CreateContactEntities(
-        mesh, *myVectorCommunicator, contact_primary_block_ids, contact_secondary_block_ids);
-    if (contact_visualization) {
-      std::string tag = "out";
-      std::string contact_visualization_exodus_file_name =
-          nimble::IOFileName(parser.ContactVisualizationFileName(), "e", tag, my_rank, num_ranks);
-      contact_manager->InitializeContactVisualization(contact_visualization_exodus_file_name);
+    auto const& contact_strings = parser.ContactStrings();
+    for (std::size_t i_interaction = 0; i_interaction < contact_strings.size(); ++i_interaction) {
+      auto const interaction = nimble::ParseContactInteraction(
+          contact_strings[i_interaction], "contact_" + std::to_string(i_interaction + 1), parser.ContactDicing());
+      std::vector<int> contact_primary_block_ids, contact_secondary_block_ids;
+      mesh.BlockNamesToOnProcessorBlockIds(interaction.primary_block_names, contact_primary_block_ids);
+      mesh.BlockNamesToOnProcessorBlockIds(interaction.secondary_block_names, contact_secondary_block_ids);
+      auto contact_manager = nimble::GetContactManager(contact_interface, data_manager, interaction);
+      contact_manager->SetPenaltyParameter(interaction.penalty_parameter);
+      contact_manager->CreateContactEntities(
+          mesh, *myVectorCommunicator, contact_primary_block_ids, contact_secondary_block_ids);
+      if (contact_visualization) {
+        std::string tag = (contact_strings.size() == 1) ? "out" : interaction.name;
+        std::string contact_visualization_exodus_file_name =
+            nimble::IOFileName(parser.ContactVisualizationFileName(), "e", tag, my_rank, num_ranks);
+        contact_manager->InitializeContactVisualization(contact_visualization_exodus_file_name);
+      }
+      contact_managers.push_back(contact_manager);
     }
   }
 
+  //
+  // The contact force is evaluated concurrently with the internal force when
+  // every interaction splits into a rank-local phase and a reduction.
+  // The Kokkos device loop keeps the sequential order.
+  //
+  bool overlap_contact = contact_enabled && parser.OverlapContact() && !parser.UseKokkos();
+  for (auto const& contact_manager : contact_managers)
+    overlap_contact = overlap_contact && contact_manager->HasLocalContactForce();
+  if (parser.OverlapContact() && !overlap_contact && my_rank == 0) {
+    std::cout << "\n**** Warning: contact overlap is not supported by this contact setup, "
+              << "the contact force is evaluated after the internal force.\n"
+              << std::endl;
+  }
+
   auto& model_data = *(data_manager.GetModelData());
 
   int status = 0;
@@ -472,9 +770,28 @@ ExplicitTimeIntegrator(
   model_data.ApplyKinematicConditions(data_manager, 0.0, 0.0);
   watch_simulation.pop_region_and_report_time();
 
+  //
+  // With Kokkos, the whole time step runs on the device and the host mirrors
+  // are only synchronized for output, contact, and MPI reductions
+  //
+#ifdef NIMBLE_HAVE_KOKKOS
+  const auto&               field_ids = data_manager.GetFieldIDs();
+  nimble_kokkos::ModelData* kokkos_model_data =
+      parser.UseKokkos() ? dynamic_cast<nimble_kokkos::ModelData*>(&model_data) : nullptr;
+  if (kokkos_model_data) {
+    kokkos_model_data->CopyVectorNodeDataToDevice(field_ids.displacement);
+    kokkos_model_data->CopyVectorNodeDataToDevice(field_ids.velocity);
+    kokkos_model_data->CopyVectorNodeDataToDevice(field_ids.acceleration);
+    // ComputeExternalForce() is a placeholder, the external force is constant
+    kokkos_model_data->CopyVectorNodeDataToDevice(field_ids.external_force);
+  }
+#endif
+
   data_manager.WriteOutput(time_current);
 
-  if (contact_visualization) { contact_manager->ContactVisualizationWriteStep(time_current); }
+  if (contact_visualization) {
+    for (auto& contact_manager : contact_managers) contact_manager->ContactVisualizationWriteStep(time_current);
+  }
 
   if (my_rank == 0) {
     std::cout << "\nUser specified time step:              " << user_specified_time_step << std::endl;
@@ -519,6 +836,66 @@ ExplicitTimeIntegrator(
     delta_time      = time_current - time_previous;
     half_delta_time = 0.5 * delta_time;
 
+#ifdef NIMBLE_HAVE_KOKKOS
+    if (kokkos_model_data) {
+      watch_internal.push_region("Time Integration Scheme");
+      // V^{n+1/2} = V^{n} + (dt/2) * A^{n}
+      kokkos_model_data->AxpyVectorNodeDataOnDevice(field_ids.velocity, half_delta_time, field_ids.acceleration);
+      total_dynamics_time += watch_internal.pop_region_and_report_time();
+
+      watch_internal.push_region("BC enforcement");
+      kokkos_model_data->ApplyKinematicConditionsOnDevice(data_manager, time_current, time_previous);
+      watch_internal.pop_region_and_report_time();
+
+      watch_internal.push_region("Time Integration Scheme");
+      // U^{n+1} = U^{n} + (dt)*V^{n+1/2}
+      kokkos_model_data->AxpyVectorNodeDataOnDevice(field_ids.displacement, delta_time, field_ids.velocity);
+      total_dynamics_time += watch_internal.pop_region_and_report_time();
+
+      watch_internal.push_region("BC enforcement");
+      kokkos_model_data->ApplyKinematicConditionsOnDevice(data_manager, time_current, time_previous);
+      watch_internal.pop_region_and_report_time();
+
+      watch_internal.push_region("Force calculation");
+      kokkos_model_data->ComputeInternalForceOnDevice(data_manager, time_previous, time_current, is_output_step);
+      total_force_time += watch_internal.pop_region_and_report_time();
+
+      if (contact_enabled) {
+        watch_internal.push_region("Contact");
+        // the contact managers read the device displacement and reduce the host contact force
+        nimble::ComputeContactForce(contact_managers, contact_force);
+        if (num_ranks > 1) { kokkos_model_data->CopyVectorNodeDataToDevice(field_ids.contact_force); }
+        total_contact_time += watch_internal.pop_region_and_report_time();
+        std::size_t tmpNum = 0;
+        for (auto const& contact_manager : contact_managers) tmpNum += contact_manager->numActiveContactFaces();
+        if (tmpNum) contactInfo.insert(std::make_pair(step, tmpNum));
+      }
+
+      watch_internal.push_region("Time Integration Scheme");
+      // A^{n+1} = M^{-1} ( F^{n} + b^{n} ), V^{n+1} = V^{n+1/2} + (dt/2)*A^{n+1}
+      kokkos_model_data->ComputeAccelerationOnDevice(data_manager, contact_enabled);
+      kokkos_model_data->AxpyVectorNodeDataOnDevice(field_ids.velocity, half_delta_time, field_ids.acceleration);
+      total_dynamics_time += watch_internal.pop_region_and_report_time();
+
+      if (is_output_step) {
+        watch_internal.push_region("Output");
+        kokkos_model_data->ApplyKinematicConditionsOnDevice(data_manager, time_current, time_previous);
+        kokkos_model_data->CopyVectorNodeDataToHost(field_ids.displacement);
+        kokkos_model_data->CopyVectorNodeDataToHost(field_ids.velocity);
+        kokkos_model_data->CopyVectorNodeDataToHost(field_ids.acceleration);
+        kokkos_model_data->CopyVectorNodeDataToHost(field_ids.internal_force);
+        data_manager.WriteOutput(time_current);
+        if (contact_visualization) {
+          for (auto& contact_manager : contact_managers) contact_manager->ContactVisualizationWriteStep(time_current);
+        }
+        total_exodus_write_time += watch_internal.pop_region_and_report_time();
+      }
+
+      model_data.UpdateStates(data_manager);
+      continue;
+    }
+#endif
+
     watch_internal.push_region("Time Integration Scheme");
     // V^{n+1/2} = V^{n} + (dt/2) * A^{n}
     velocity += half_delta_time * acceleration;
@@ -541,6 +918,18 @@ ExplicitTimeIntegrator(
     model_data.ApplyKinematicConditions(data_manager, time_current, time_previous);
     watch_internal.pop_region_and_report_time();
 
+    //
+    // The displacement is final here, so the rank-local contact pipeline
+    // (entity update, search and enforcement) runs alongside the force evaluation.
+    // All communication stays on this thread.
+    //
+    std::future<void> local_contact_force;
+    if (overlap_contact) {
+      local_contact_force = std::async(std::launch::async, [&contact_managers, contact_force]() {
+        nimble::ComputeLocalContactForce(contact_managers, contact_force);
+      });
+    }
+
     //
     // Evaluate external body forces
     //
@@ -557,33 +946,40 @@ ExplicitTimeIntegrator(
     // Evaluate the contact force
     if (contact_enabled) {
       watch_internal.push_region("Contact");
-      contact_manager->ComputeContactForce(step + 1, contact_visualization && is_output_step, contact_force);
+      if (overlap_contact) {
+        // only the part of the contact pipeline not hidden behind the internal force is timed
+        local_contact_force.get();
+        nimble::ReduceContactForce(contact_managers, contact_force);
+      } else {
+        nimble::ComputeContactForce(contact_managers, contact_force);
+      }
       total_contact_time += watch_internal.pop_region_and_report_time();
-      auto tmpNum = contact_manager->numActiveContactFaces();
+      std::size_t tmpNum = 0;
+      for (auto const& contact_manager : contact_managers) tmpNum += contact_manager->numActiveContactFaces();
       if (tmpNum) contactInfo.insert(std::make_pair(step, tmpNum));
     }
 
     // fill acceleration vector A^{n+1} = M^{-1} ( F^{n} + b^{n} )
+    // and V^{n+1}   = V^{n+1/2} + (dt/2)*A^{n+1} in the same pass
     watch_internal.push_region("Time Integration Scheme");
     if (contact_enabled) {
       for (int i = 0; i < num_nodes; ++i) {
         const double oneOverM = 1.0 / lumped_mass(i);
-        acceleration(i, 0)    = oneOverM * (internal_force(i, 0) + external_force(i, 0) + contact_force(i, 0));
-        acceleration(i, 1)    = oneOverM * (internal_force(i, 1) + external_force(i, 1) + contact_force(i, 1));
-        acceleration(i, 2)    = oneOverM * (internal_force(i, 2) + external_force(i, 2) + contact_force(i, 2));
+        for (int j = 0; j < 3; ++j) {
+          acceleration(i, j) = oneOverM * (internal_force(i, j) + external_force(i, j) + contact_force(i, j));
+          velocity(i, j) += half_delta_time * acceleration(i, j);
+        }
       }
     } else {
       for (int i = 0; i < num_nodes; ++i) {
         const double oneOverM = 1.0 / lumped_mass(i);
-        acceleration(i, 0)    = oneOverM * (internal_force(i, 0) + external_force(i, 0));
-        acceleration(i, 1)    = oneOverM * (internal_force(i, 1) + external_force(i, 1));
-        acceleration(i, 2)    = oneOverM * (internal_force(i, 2) + external_force(i, 2));
+        for (int j = 0; j < 3; ++j) {
+          acceleration(i, j) = oneOverM * (internal_force(i, j) + external_force(i, j));
+          velocity(i, j) += half_delta_time * acceleration(i, j);
+        }
       }
     }
 
-    // V^{n+1}   = V^{n+1/2} + (dt/2)*A^{n+1}
-    velocity += half_delta_time * acceleration;
-
     model_data.UpdateWithNewVelocity(data_manager, half_delta_time);
 
     total_dynamics_time += watch_internal.pop_region_and_report_time();
@@ -595,7 +991,9 @@ ExplicitTimeIntegrator(
       //
       data_manager.WriteOutput(time_current);
       //
-      if (contact_visualization) { contact_manager->ContactVisualizationWriteStep(time_current); }
+      if (contact_visualization) {
+        for (auto& contact_manager : contact_managers) contact_manager->ContactVisualizationWriteStep(time_current);
+      }
       total_exodus_write_time += watch_internal.pop_region_and_report_time();
     }  // if (is_output_step)
 
@@ -634,9 +1032,11 @@ ExplicitTimeIntegrator(
     std::cout << "Total step time = " << total_simulation_time << '\n';
     std::cout << " --- Update A, V, U: " << total_dynamics_time << '\n';
     std::cout << " --- Force: " << total_force_time << "\n";
-    if ((contact_enabled) && (contact_manager)) {
+    if ((contact_enabled) && (!contact_managers.empty())) {
       std::cout << " --- Contact time: " << total_contact_time << '\n';
-      auto list_timers = contact_manager->getTimers();
+      std::map<std::string, double> list_timers;
+      for (auto& contact_manager : contact_managers)
+        for (const auto& st_pair : contact_manager->getTimers()) list_timers[st_pair.first] += st_pair.second;
       for (const auto& st_pair : list_timers)
         std::cout << " --- >>> >>> " << st_pair.first << " = " << st_pair.second << "\n";
     }
@@ -655,6 +1055,8 @@ QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mes
   const int my_rank   = parser.GetRankID();
   const int num_ranks = parser.GetNumRanks();
 
+  const bool implicit_dynamics = (parser.TimeIntegrationScheme() == "implicit dynamics");
+
   if (num_ranks > 1) {
     std::string msg = " Quasi-statics currently not implemented in parallel "
                       "(work in progress).\n";
@@ -670,17 +1072,12 @@ QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mes
 
   auto& bc = *(data_manager.GetBoundaryConditionManager());
 
-  // Store various mappings from global to local node ids
-  std::vector<int>                linear_system_global_node_ids;
-  std::map<int, std::vector<int>> map_from_linear_system;
-  for (int n = 0; n < num_nodes; ++n) {
-    int global_node_id = global_node_ids[n];
-    linear_system_global_node_ids.push_back(global_node_id);
-    map_from_linear_system[global_node_id] = std::vector<int>();
-    map_from_linear_system[global_node_id].push_back(n);
-  }
-  int linear_system_num_nodes    = static_cast<int>(map_from_linear_system.size());
-  int linear_system_num_unknowns = linear_system_num_nodes * dim;
+  // Store the mapping between the nodal fields and the linear system
+  LinearSystemDofMap dof_map;
+  dof_map.Initialize(num_nodes, dim, global_node_ids, bc);
+  const std::vector<int>& linear_system_global_node_ids = dof_map.linear_system_node_ids;
+  int                     linear_system_num_nodes       = num_nodes;
+  int                     linear_system_num_unknowns    = linear_system_num_nodes * dim;
 
   std::vector<double> global_data;
 
@@ -696,7 +1093,8 @@ QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mes
   auto displacement_fluctuation = model_data.GetVectorNodeData("displacement_fluctuation");
   auto trial_displacement       = model_data.GetVectorNodeData("trial_displacement");
 
-  auto velocity = model_data.GetVectorNodeData("velocity");
+  auto velocity     = model_data.GetVectorNodeData("velocity");
+  auto acceleration = model_data.GetVectorNodeData("acceleration");
 
   auto internal_force       = model_data.GetVectorNodeData("internal_force");
   auto trial_internal_force = model_data.GetVectorNodeData("trial_internal_force");
@@ -709,9 +1107,9 @@ QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mes
 
   nimble::CRSMatrixContainer tangent_stiffness;
   nimble::CGScratchSpace     cg_scratch;
-  std::vector<int>           i_index, j_index;
-  nimble::DetermineTangentMatrixNonzeroStructure(mesh, linear_system_global_node_ids, i_index, j_index);
-  tangent_stiffness.AllocateNonzeros(i_index, j_index);
+  std::vector<int>           row_first_index, j_index;
+  nimble::DetermineTangentMatrixRowStructure(mesh, linear_system_global_node_ids, row_first_index, j_index);
+  tangent_stiffness.AllocateRowStructure(std::move(row_first_index), std::move(j_index));
   if (my_rank == 0) {
     std::cout << "Number of nonzeros in tangent stiffness matrix = " << tangent_stiffness.NumNonzeros() << "\n"
               << std::endl;
@@ -743,7 +1141,37 @@ QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mes
   }
 
 #ifdef NIMBLE_HAVE_UQ
-  if (parser.UseUQ()) NIMBLE_ABORT("\nError:  UQ enabled but not implemented for quasistatics.\n");
+  //
+  // UQ: the exact samples are solved with the nominal tangent stiffness and
+  // its preconditioner, one right-hand side per sample, and the approximate
+  // samples are interpolated from the converged exact samples by the closure
+  //
+  std::shared_ptr<nimble::UqModel> uq_model;
+  std::vector<nimble::Viewify<2>>  uq_displacements, uq_forces;
+  std::vector<double>              uq_residual_vector, uq_solution, uq_convergence_tolerance;
+  int                              uq_num_exact_samples = 0;
+  if (parser.UseUQ()) {
+    if (implicit_dynamics) NIMBLE_ABORT("\nError:  UQ enabled but not implemented for implicit dynamics.\n");
+    auto* uq_model_data = dynamic_cast<nimble_uq::ModelData*>(model_data_ptr);
+    if (uq_model_data == nullptr) { throw std::invalid_argument(" Incompatible UQ Model Data \n"); }
+    uq_model             = uq_model_data->GetUqModel();
+    uq_num_exact_samples = uq_model->GetNumExactSamples();
+    for (int s = 0; s < uq_num_exact_samples; s++) {
+      uq_displacements.push_back(nimble::Viewify<2>(uq_model->Displacements()[s], {num_nodes, 3}, {3, 1}));
+      uq_forces.push_back(nimble::Viewify<2>(uq_model->Forces()[s], {num_nodes, 3}, {3, 1}));
+    }
+    uq_residual_vector.resize(linear_system_num_unknowns);
+    uq_solution.resize(linear_system_num_unknowns);
+    uq_convergence_tolerance.resize(uq_num_exact_samples);
+  }
+
+  // Residual norm of an exact sample, from the sample forces of the last
+  // internal force evaluation
+  auto uq_residual = [&](int s) {
+    dof_map.Gather(-1.0, uq_forces[s], uq_residual_vector.data());
+    dof_map.ZeroConstrainedDof(uq_residual_vector.data());
+    return std::sqrt(nimble::InnerProduct(uq_residual_vector, uq_residual_vector));
+  };
 #endif
 
   model_data.ApplyKinematicConditions(data_manager, time_current, time_previous);
@@ -753,170 +1181,366 @@ QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mes
 
   auto& blocks = model_data.GetBlocks();
 
+  //
+  // Newmark / HHT-alpha data for implicit dynamics
+  //
+  NewmarkData  newmark;
+  NewmarkData* inertia = nullptr;
+  if (implicit_dynamics) {
+    inertia = &newmark;
+    newmark.Initialize(parser.HHTAlpha(), parser.MassProportionalDamping(), num_nodes, dim);
+    model_data.ApplyInitialConditions(data_manager);
+    model_data.ComputeLumpedMass(data_manager);
+    auto const lumped_mass = model_data.GetScalarNodeData("lumped_mass");
+    for (int n = 0; n < num_nodes; n++) newmark.lumped_mass[n] = lumped_mass(n);
+    // Mask with zeros on the dof with kinematic BC, indexed by local node ids
+    std::vector<int> local_node_ids(num_nodes);
+    for (int n = 0; n < num_nodes; n++) local_node_ids[n] = n;
+    bc.ModifyRHSForKinematicBC(local_node_ids.data(), newmark.free_dof.data());
+    // Initial acceleration, A^{0} = M^{-1} F^{0} on the dof without kinematic BC
+    ComputeQuasistaticResidual(
+        mesh,
+        data_manager,
+        dof_map,
+        time_previous,
+        time_current,
+        displacement,
+        internal_force,
+        residual_vector.data(),
+        false);
+    for (int n = 0; n < num_nodes; n++) {
+      for (int dof = 0; dof < dim; dof++) {
+        int ls_index         = linear_system_global_node_ids[n] * dim + dof;
+        acceleration(n, dof) = -1.0 * residual_vector[ls_index] / newmark.lumped_mass[n];
+      }
+    }
+  }
+
   data_manager.WriteOutput(time_current);
 
-  if (my_rank == 0) { std::cout << "Beginning quasistatic time integration:" << std::endl; }
+  if (my_rank == 0) {
+    if (implicit_dynamics) {
+      std::cout << "Beginning implicit dynamics time integration (HHT alpha = " << newmark.alpha
+                << ", maximum stable explicit time step " << model_data.GetCriticalTimeStep() << "):" << std::endl;
+    } else {
+      std::cout << "Beginning quasistatic time integration:" << std::endl;
+    }
+  }
 
-  for (int step = 0; step < num_load_steps; step++) {
+  //
+  // Tangent refresh strategy: full Newton assembles the tangent at every
+  // iteration, modified Newton and BFGS keep it across iterations and load
+  // steps until the convergence rate degrades or the refresh interval is reached.
+  //
+  const std::string nonlinear_solver   = parser.NonlinearSolver();
+  const bool        use_bfgs           = (nonlinear_solver == "bfgs");
+  const bool        keep_tangent       = (nonlinear_solver != "full newton");
+  double            tangent_delta_time = 0.0;
+
+  nimble::TangentRefreshPolicy tangent_refresh(
+      keep_tangent, parser.TangentRefreshInterval(), parser.TangentRefreshRatio());
+
+  nimble::LimitedMemoryBFGS bfgs;
+  std::vector<double>       bfgs_step, bfgs_residual_change;
+  if (use_bfgs) {
+    bfgs_step.resize(linear_system_num_unknowns);
+    bfgs_residual_change.resize(linear_system_num_unknowns);
+  }
+
+  // Line search parameters (sufficient decrease of the residual norm)
+  const double line_search_sufficient_decrease = 1.0e-4;
+  const int    max_line_search_backtracks      = 3;
+
+  // The line search swaps the current and trial buffers, this moves the
+  // accepted iterate back into the model data fields
+  auto physical_internal_force = internal_force;
+  auto restore_field_buffers   = [&]() {
+    if (displacement.data() != physical_displacement.data()) {
+      physical_displacement.copy(displacement);
+      physical_internal_force.copy(internal_force);
+      std::swap(displacement, trial_displacement);
+      std::swap(internal_force, trial_internal_force);
+    }
+  };
+
+  //
+  // For implicit dynamics, the time step is cut back when Newton fails and
+  // recovers towards the user-specified time step on easy steps.
+  //
+  const int    max_time_step_cuts   = 10;
+  const double time_tolerance       = 1.0e-12 * (final_time - initial_time);
+  double       time_step            = user_specified_time_step;
+  int          num_consecutive_cuts = 0;
+
+  // Quasistatic runs take exactly the requested number of load steps, implicit
+  // dynamics marches in time because cut steps change the step count.
+  auto more_steps = [&](int step) {
+    if (implicit_dynamics) return final_time - time_current > time_tolerance;
+    return step < num_load_steps;
+  };
+
+  for (int step = 0; more_steps(step); step++) {
     time_previous = time_current;
-    time_current += user_specified_time_step;
+    if (implicit_dynamics) {
+      time_step    = std::min(time_step, final_time - time_previous);
+      time_current = time_previous + time_step;
+    } else {
+      time_current += user_specified_time_step;
+    }
     delta_time = time_current - time_previous;
 
+    bool is_last_step =
+        implicit_dynamics ? (final_time - time_current <= time_tolerance) : (step == num_load_steps - 1);
     bool is_output_step = false;
     if (output_frequency != 0) {
-      if (step % output_frequency == 0 || step == num_load_steps - 1) { is_output_step = true; }
+      if (step % output_frequency == 0 || is_last_step) { is_output_step = true; }
     }
 
+    if (implicit_dynamics) newmark.BeginStep(delta_time, displacement, velocity, acceleration, internal_force);
+
     model_data.ApplyKinematicConditions(data_manager, time_current, time_previous);
 
+#ifdef NIMBLE_HAVE_UQ
+    // The kinematic BC do not depend on the parameters, the exact samples
+    // take the prescribed displacements of the nominal solution
+    for (auto& uq_displacement : uq_displacements) dof_map.CopyConstrainedDof(displacement, uq_displacement);
+#endif
+
     // Compute the residual, which is a norm of the (rearranged) nodal force
     // vector, with the dof associated with kinematic BC removed.
     double residual = ComputeQuasistaticResidual(
         mesh,
         data_manager,
-        bc,
-        linear_system_num_unknowns,
-        linear_system_global_node_ids,
+        dof_map,
         time_previous,
         time_current,
         displacement,
         internal_force,
         residual_vector.data(),
-        is_output_step);
+        is_output_step,
+        inertia);
 
     int    iteration(0);
     int    max_nonlinear_iterations = parser.NonlinearSolverMaxIterations();
     double convergence_tolerance    = parser.NonlinearSolverRelativeTolerance() * residual;
 
+    // Each exact sample converges relative to its own initial residual
+    bool uq_converged = true;
+#ifdef NIMBLE_HAVE_UQ
+    for (int s = 0; s < uq_num_exact_samples; s++) {
+      double sample_residual      = uq_residual(s);
+      uq_convergence_tolerance[s] = parser.NonlinearSolverRelativeTolerance() * sample_residual;
+      if (sample_residual > uq_convergence_tolerance[s]) uq_converged = false;
+    }
+#endif
+
     if (my_rank == 0) {
       std::cout << "\nStep " << step + 1 << std::scientific << std::setprecision(3) << ", time " << time_current
                 << ", delta_time " << delta_time << ", convergence tolerance " << convergence_tolerance << std::endl;
       std::cout << "  iteration " << iteration << ": residual = " << residual << std::endl;
     }
 
-    while (residual > convergence_tolerance && iteration < max_nonlinear_iterations) {
-      tangent_stiffness.SetAllValues(0.0);
+    if (use_bfgs) bfgs.Clear();
+    bool linear_solver_failed = false;
+    while ((residual > convergence_tolerance || !uq_converged) && iteration < max_nonlinear_iterations) {
+      // The effective stiffness of implicit dynamics depends on the time step
+      if (implicit_dynamics && delta_time != tangent_delta_time) tangent_refresh.Invalidate();
+      bool   assemble_tangent         = tangent_refresh.NeedsAssembly();
+      double iteration_start_residual = residual;
+
+      if (assemble_tangent) {
+        tangent_stiffness.SetAllValues(0.0);
 #ifdef NIMBLE_HAVE_TRILINOS
-//      tpetra_container.TangentStiffnessMatrixSetScalar(0.0);
-#endif
-      for (auto& block_it : blocks) {
-        int        block_id          = block_it.first;
-        int        num_elem_in_block = mesh.GetNumElementsInBlock(block_id);
-        int const* elem_conn         = mesh.GetConnectivity(block_id);
-        auto&      block             = block_it.second;
-        block->ComputeTangentStiffnessMatrix(
-            linear_system_num_unknowns,
-            reference_coordinate.data(),
-            displacement.data(),
-            num_elem_in_block,
-            elem_conn,
-            linear_system_global_node_ids.data(),
-            tangent_stiffness);
-      }
-
-      double diagonal_entry(0.0);
-      for (int i = 0; i < linear_system_num_unknowns; ++i) { diagonal_entry += std::abs(tangent_stiffness(i, i)); }
-      diagonal_entry /= linear_system_num_unknowns;
-
-      // For the dof with kinematic BC, zero out the rows and columns and put a
-      // non-zero on the diagonal
-      bc.ModifyTangentStiffnessMatrixForKinematicBC(
-          linear_system_num_unknowns, linear_system_global_node_ids.data(), diagonal_entry, tangent_stiffness);
-      bc.ModifyRHSForKinematicBC(linear_system_global_node_ids.data(), residual_vector.data());
-
-      // Solve the linear system with the tangent stiffness matrix
+//        tpetra_container.TangentStiffnessMatrixSetScalar(0.0);
+#endif
+        for (auto& block_it : blocks) {
+          int        block_id          = block_it.first;
+          int        num_elem_in_block = mesh.GetNumElementsInBlock(block_id);
+          int const* elem_conn         = mesh.GetConnectivity(block_id);
+          auto&      block             = block_it.second;
+          block->ComputeTangentStiffnessMatrix(
+              linear_system_num_unknowns,
+              reference_coordinate.data(),
+              displacement.data(),
+              num_elem_in_block,
+              elem_conn,
+              linear_system_global_node_ids.data(),
+              tangent_stiffness);
+        }
+
+        // Effective stiffness (1 + alpha) K + (mass and damping terms) M
+        if (implicit_dynamics) newmark.AddInertialTangent(linear_system_global_node_ids, tangent_stiffness);
+
+        double diagonal_entry(0.0);
+        for (int i = 0; i < linear_system_num_unknowns; ++i) { diagonal_entry += std::abs(tangent_stiffness(i, i)); }
+        diagonal_entry /= linear_system_num_unknowns;
+
+        // For the dof with kinematic BC, zero out the rows and columns and put a
+        // non-zero on the diagonal
+        bc.ModifyTangentStiffnessMatrixForKinematicBC(
+            linear_system_num_unknowns, linear_system_global_node_ids.data(), diagonal_entry, tangent_stiffness);
+
+        tangent_refresh.Assembled();
+        tangent_delta_time = delta_time;
+        if (use_bfgs) bfgs.Clear();
+      }
+      dof_map.ZeroConstrainedDof(residual_vector.data());
+
+      // Solve the linear system with the tangent stiffness matrix, the
+      // preconditioner is rebuilt only when the tangent has changed
       int num_cg_iterations(0);
       std::fill(linear_solver_solution.begin(), linear_solver_solution.end(), 0.0);
-      bool success = nimble::CG_SolveSystem(
-          tangent_stiffness, residual_vector.data(), cg_scratch, linear_solver_solution.data(), num_cg_iterations);
+      cg_scratch.keep_preconditioner = !assemble_tangent;
+      bool success                   = false;
+      if (use_bfgs) {
+        // BFGS direction H r, with H0 the inverse of the stored tangent
+        bfgs_step = residual_vector;
+        bfgs.ApplyFirstLoop(bfgs_step);
+        success = nimble::CG_SolveSystem(
+            tangent_stiffness, bfgs_step.data(), cg_scratch, linear_solver_solution.data(), num_cg_iterations);
+        bfgs.ApplySecondLoop(linear_solver_solution);
+        bfgs_residual_change = residual_vector;
+      } else {
+        success = nimble::CG_SolveSystem(
+            tangent_stiffness, residual_vector.data(), cg_scratch, linear_solver_solution.data(), num_cg_iterations);
+      }
+      if (!success && !assemble_tangent) {
+        // CG may fail on a stale tangent, retry the iteration once with a fresh
+        // one before giving up
+        if (my_rank == 0) {
+          std::cout << "  CG solver failed with the stored tangent, reassembling it" << std::endl;
+        }
+        tangent_refresh.Invalidate();
+        continue;
+      }
+#ifdef NIMBLE_HAVE_UQ
+      // Modified Newton step of each exact sample with the nominal tangent, the
+      // preconditioner of the nominal solve is reused for every right-hand side.
+      // The sample forces at the new displacements come with the next residual.
+      cg_scratch.keep_preconditioner = true;
+      for (int s = 0; s < uq_num_exact_samples && success; s++) {
+        if (uq_residual(s) <= uq_convergence_tolerance[s]) continue;
+        int num_uq_cg_iterations(0);
+        std::fill(uq_solution.begin(), uq_solution.end(), 0.0);
+        success = nimble::CG_SolveSystem(
+            tangent_stiffness, uq_residual_vector.data(), cg_scratch, uq_solution.data(), num_uq_cg_iterations);
+        UpdateDisplacement(dof_map, -1.0, uq_solution, uq_displacements[s], uq_displacements[s]);
+      }
+#endif
       if (!success) {
         if (my_rank == 0) {
           std::cout << "\n**** CG solver failed to converge!\n" << std::endl;
         }
-        status = 1;
-        return status;
+        linear_solver_failed = true;
+        break;
       }
 
       //
       // Apply a line search
       //
+      // The full step is accepted when it reduces the residual sufficiently.
+      // Otherwise the step length from a secant approximation (or a bisection
+      // when the secant step is not in (0, 1)) is backtracked until the
+      // residual decreases sufficiently, and the better of the full step and
+      // the reduced step is kept. Accepting an iterate swaps the current and
+      // trial buffers instead of copying them.
+      //
 
       // evaluate residual for alpha = 1.0
-      for (int n = 0; n < linear_system_num_nodes; n++) {
-        std::vector<int> const& node_ids = map_from_linear_system[n];
-        for (auto const& node_id : node_ids) {
-          for (int dof = 0; dof < dim; dof++) {
-            int ls_index = n * dim + dof;
-#ifdef NIMBLE_DEBUG
-            if (ls_index < 0 || ls_index > linear_solver_solution.size() - 1) {
-              throw std::invalid_argument(
-                  "\nError:  Invalid index into linear solver solution in "
-                  "QuasistaticTimeIntegrator().\n");
-            }
-#endif
-            trial_displacement(node_id, dof) = displacement(node_id, dof) - linear_solver_solution[ls_index];
-          }
-        }
-      }
+      UpdateDisplacement(dof_map, -1.0, linear_solver_solution, displacement, trial_displacement);
       double trial_residual = ComputeQuasistaticResidual(
           mesh,
           data_manager,
-          bc,
-          linear_system_num_unknowns,
-          linear_system_global_node_ids,
+          dof_map,
           time_previous,
           time_current,
           trial_displacement,
           trial_internal_force,
           trial_residual_vector.data(),
-          is_output_step);
+          is_output_step,
+          inertia);
 
-      //
-      // secant line search
-      //
-      double sr        = nimble::InnerProduct(linear_solver_solution, residual_vector);
-      double s_trial_r = nimble::InnerProduct(linear_solver_solution, trial_residual_vector);
-      double alpha     = -1.0 * sr / (s_trial_r - sr);
-
-      // evaluate residual for alpha computed with secant line search
-      for (int n = 0; n < linear_system_num_nodes; n++) {
-        std::vector<int> const& node_ids = map_from_linear_system[n];
-        for (auto const& node_id : node_ids) {
-          for (int dof = 0; dof < dim; dof++) {
-            int ls_index = n * dim + dof;
-#ifdef NIMBLE_DEBUG
-            if (ls_index < 0 || ls_index > linear_solver_solution.size() - 1) {
-              throw std::invalid_argument(
-                  "\nError:  Invalid index into linear solver solution vector in "
-                  "QuasistaticTimeIntegrator().\n");
-            }
-#endif
-            displacement(node_id, dof) -= alpha * linear_solver_solution[ls_index];
+      double alpha = 1.0;
+      if (trial_residual <= (1.0 - line_search_sufficient_decrease) * residual) {
+        residual = trial_residual;
+        std::swap(displacement, trial_displacement);
+        std::swap(internal_force, trial_internal_force);
+        std::swap(residual_vector, trial_residual_vector);
+      } else {
+        //
+        // secant line search
+        //
+        double sr        = nimble::InnerProduct(linear_solver_solution, residual_vector);
+        double s_trial_r = nimble::InnerProduct(linear_solver_solution, trial_residual_vector);
+        alpha            = -1.0 * sr / (s_trial_r - sr);
+        if (!(alpha > 0.0 && alpha < 1.0)) alpha = 0.5;
+
+        // evaluate residual for alpha computed with secant line search, then backtrack
+        double reduced_residual    = residual;
+        double alpha_applied       = 0.0;
+        int    num_backtrack_steps = 0;
+        while (true) {
+          UpdateDisplacement(dof_map, alpha_applied - alpha, linear_solver_solution, displacement, displacement);
+          alpha_applied    = alpha;
+          reduced_residual = ComputeQuasistaticResidual(
+              mesh,
+              data_manager,
+              dof_map,
+              time_previous,
+              time_current,
+              displacement,
+              internal_force,
+              residual_vector.data(),
+              is_output_step,
+              inertia);
+          if (reduced_residual <= (1.0 - line_search_sufficient_decrease * alpha) * residual ||
+              num_backtrack_steps == max_line_search_backtracks) {
+            break;
           }
+          alpha *= 0.5;
+          num_backtrack_steps += 1;
+        }
+        residual = reduced_residual;
+
+        // if the alpha = 1.0 result was better, use alpha = 1.0, the material
+        // states at step n+1 come from the last backtracked trial and are
+        // evaluated again at the full step
+        if (trial_residual < residual) {
+          std::swap(displacement, trial_displacement);
+          alpha    = 1.0;
+          residual = ComputeQuasistaticResidual(
+              mesh,
+              data_manager,
+              dof_map,
+              time_previous,
+              time_current,
+              displacement,
+              internal_force,
+              residual_vector.data(),
+              is_output_step,
+              inertia);
         }
       }
-      residual = ComputeQuasistaticResidual(
-          mesh,
-          data_manager,
-          bc,
-          linear_system_num_unknowns,
-          linear_system_global_node_ids,
-          time_previous,
-          time_current,
-          displacement,
-          internal_force,
-          residual_vector.data(),
-          is_output_step);
 
-      // if the alpha = 1.0 result was better, use alpha = 1.0
-      if (trial_residual < residual) {
-        residual = trial_residual;
-        displacement.copy(trial_displacement);
-        internal_force.copy(trial_internal_force);
-        for (int i = 0; i < linear_system_num_unknowns; i++) { residual_vector[i] = trial_residual_vector[i]; }
+      if (use_bfgs) {
+        // secant pair s = U^{k+1} - U^{k}, y = R^{k+1} - R^{k}
+        nimble::Viewify<1> s_view(bfgs_step.data(), linear_system_num_unknowns);
+        nimble::Viewify<1> y_view(bfgs_residual_change.data(), linear_system_num_unknowns);
+        nimble::Viewify<1> solution_view(linear_solver_solution.data(), linear_system_num_unknowns);
+        nimble::Viewify<1> r_view(residual_vector.data(), linear_system_num_unknowns);
+        nimble::FusedAssign(s_view, (-alpha) * solution_view, y_view, r_view - y_view);
+        bfgs.AddPair(bfgs_step, bfgs_residual_change);
       }
 
       iteration += 1;
+      tangent_refresh.Iterated(iteration_start_residual, residual);
+
+#ifdef NIMBLE_HAVE_UQ
+      uq_converged = true;
+      for (int s = 0; s < uq_num_exact_samples; s++) {
+        if (uq_residual(s) > uq_convergence_tolerance[s]) uq_converged = false;
+      }
+#endif
 
       if (my_rank == 0) {
         std::cout << "  iteration " << iteration << ": residual = " << residual
@@ -925,7 +1549,26 @@ QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mes
 
     }  // while (residual > convergence_tolerance ... )
 
-    if (iteration == max_nonlinear_iterations) {
+    bool step_failed = linear_solver_failed || iteration == max_nonlinear_iterations;
+
+    if (step_failed && implicit_dynamics && num_consecutive_cuts < max_time_step_cuts) {
+      // Restore the state at time n and retry with half the time step
+      newmark.RestoreStep(displacement, velocity, acceleration, internal_force);
+      restore_field_buffers();
+      time_current = time_previous;
+      time_step *= 0.5;
+      num_consecutive_cuts += 1;
+      step -= 1;
+      if (my_rank == 0) { std::cout << "\n**** Cutting back the time step to " << time_step << std::endl; }
+      continue;
+    }
+
+    if (linear_solver_failed) {
+      status = 1;
+      return status;
+    }
+
+    if (step_failed) {
       if (my_rank == 0) {
         std::cout << "\n**** Nonlinear solver failed to converge!\n" << std::endl;
         std::cout << "**** Relevant input deck parameters for the nonlinear solver:" << std::endl;
@@ -936,71 +1579,368 @@ QuasistaticTimeIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mes
       }
       status = 1;
       return status;
-    } else {
-      if (is_output_step) data_manager.WriteOutput(time_current);
     }
 
+    restore_field_buffers();
+
+#ifdef NIMBLE_HAVE_UQ
+    if (uq_model) {
+      // Approximate samples from the closure over the converged nominal and
+      // exact samples
+      uq_model->ApplyDisplacementClosure(physical_displacement.data());
+    }
+#endif
+
+    if (implicit_dynamics) {
+      newmark.EndStep(displacement, velocity, acceleration);
+      // Grow the time step back when Newton converges quickly
+      num_consecutive_cuts = 0;
+      if (iteration <= max_nonlinear_iterations / 4) {
+        time_step = std::min(1.5 * time_step, user_specified_time_step);
+      }
+    }
+
+    if (is_output_step) data_manager.WriteOutput(time_current);
+
     // swap states
     model_data.UpdateStates(data_manager);
   }
 
+  if (my_rank == 0) {
+    std::cout << "\nNumber of tangent stiffness assemblies = " << tangent_refresh.NumAssemblies() << std::endl;
+    std::cout << "\nComplete.\n" << std::endl;
+  }
+
+  return status;
+}
+
+int
+DynamicRelaxationIntegrator(const nimble::Parser& parser, nimble::GenesisMesh& mesh, nimble::DataManager& data_manager)
+{
+  const int my_rank = parser.GetRankID();
+
+  if (parser.HasContact()) {
+    throw std::invalid_argument("\nError:  Contact is not implemented for dynamic relaxation.\n");
+  }
+
+#ifdef NIMBLE_HAVE_UQ
+  if (parser.UseUQ()) NIMBLE_ABORT("\nError:  UQ enabled but not implemented for dynamic relaxation.\n");
+#endif
+
+  int status = 0;
+
+  const int dim       = mesh.GetDim();
+  const int num_nodes = static_cast<int>(mesh.GetNumNodes());
+
+  auto& bc         = *(data_manager.GetBoundaryConditionManager());
+  auto& model_data = *(data_manager.GetModelData());
+
+  auto displacement = model_data.GetVectorNodeData("displacement");
+  auto velocity     = model_data.GetVectorNodeData("velocity");
+  auto acceleration = model_data.GetVectorNodeData("acceleration");
+
+  //
+  // The fictitious mass is the lumped mass, integrated with a pseudo time step
+  // below the stable time step of the explicit scheme.  The critical time step
+  // uses the bulk wave speed, the dilatational wave speed is up to sqrt(3)
+  // times faster (Poisson ratio zero), hence the factor one half.
+  //
+  model_data.ComputeLumpedMass(data_manager);
+  auto const   lumped_mass          = model_data.GetScalarNodeData("lumped_mass");
+  const double relaxation_time_step = 0.5 * model_data.GetCriticalTimeStep();
+
+  //
+  // Mask equal to zero for the dof with kinematic BC and to one otherwise.
+  // The local node ids play the role of the linear system ids.
+  //
+  std::vector<int> local_node_ids(num_nodes);
+  for (int n = 0; n < num_nodes; ++n) local_node_ids[n] = n;
+  std::vector<double> free_dof(num_nodes * dim, 1.0);
+  bc.ModifyRHSForKinematicBC(local_node_ids.data(), free_dof.data());
+
+  //
+  // Equal to one for the nodes owned by this rank, the lowest rank containing
+  // a shared node owns it, so that the global sums count every node once
+  //
+  std::vector<double> owned_node(num_nodes, 1.0);
+  {
+    std::vector<int> partition_boundary_node_local_ids;
+    std::vector<int> min_rank_containing_partition_boundary_nodes;
+    data_manager.GetVectorCommunicator()->GetPartitionBoundaryNodeLocalIds(
+        partition_boundary_node_local_ids, min_rank_containing_partition_boundary_nodes);
+    for (size_t i = 0; i < partition_boundary_node_local_ids.size(); i++) {
+      if (min_rank_containing_partition_boundary_nodes[i] != my_rank) {
+        owned_node[partition_boundary_node_local_ids[i]] = 0.0;
+      }
+    }
+  }
+
+  std::vector<double> residual_force(num_nodes * dim, 0.0);
+  std::vector<double> previous_residual_force(num_nodes * dim, 0.0);
+
+  const bool   use_kinetic_damping = (parser.DynamicRelaxationDamping() == "kinetic energy");
+  const int    max_iterations      = parser.DynamicRelaxationMaxIterations();
+  const double relative_tolerance  = parser.NonlinearSolverRelativeTolerance();
+
+  double initial_time = parser.InitialTime();
+  double final_time   = parser.FinalTime();
+  double time_current{initial_time};
+  double time_previous{initial_time};
+  int    num_load_steps           = parser.NumLoadSteps();
+  int    output_frequency         = parser.OutputFrequency();
+  double user_specified_time_step = (final_time - initial_time) / num_load_steps;
+
+  if (my_rank == 0 && final_time < initial_time) {
+    std::string msg = "Final time: " + std::to_string(final_time)
+                      + " is less than initial time: " + std::to_string(initial_time)
+                      + "\n";
+    throw std::invalid_argument(msg);
+  }
+
+  model_data.ApplyInitialConditions(data_manager);
+  model_data.ApplyKinematicConditions(data_manager, time_current, time_previous);
+
+  data_manager.WriteOutput(time_current);
+
+  if (my_rank == 0) {
+    std::cout << "\nPseudo time step for dynamic relaxation: " << relaxation_time_step << std::endl;
+    std::cout << "Beginning dynamic relaxation (" << parser.DynamicRelaxationDamping() << " damping):" << std::endl;
+  }
+
+  for (int step = 0; step < num_load_steps; step++) {
+    time_previous = time_current;
+    time_current += user_specified_time_step;
+
+    bool is_output_step = false;
+    if (output_frequency != 0) {
+      if (step % output_frequency == 0 || step == num_load_steps - 1) { is_output_step = true; }
+    }
+
+    // Move the constrained dof to their new positions and restart at rest
+    model_data.ApplyKinematicConditions(data_manager, time_current, time_previous);
+    velocity.zero();
+    model_data.UpdateWithNewVelocity(data_manager, relaxation_time_step);
+    model_data.UpdateWithNewDisplacement(data_manager, relaxation_time_step);
+
+    double residual = ComputeDynamicRelaxationResidual(
+        data_manager, time_previous, time_current, is_output_step, free_dof, owned_node, residual_force);
+    double convergence_tolerance = relative_tolerance * residual;
+
+    const double h = relaxation_time_step;
+    int          iteration(0);
+    bool         restart(true);
+    double       damping(0.0);
+    double       kinetic_energy(0.0);
+
+    while (residual > convergence_tolerance && iteration < max_iterations) {
+      //
+      // Rayleigh quotient estimate of the lowest frequency,
+      // omega^2 = (du^T K du) / (du^T M du), where K du is approximated
+      // by the change in residual force over the last increment du = h * V
+      //
+      if (!use_kinetic_damping && !restart) {
+        double quotient[2] = {0.0, 0.0};
+        for (int n = 0; n < num_nodes; ++n) {
+          for (int dof = 0; dof < dim; ++dof) {
+            const double du      = h * velocity(n, dof);
+            const double delta_r = residual_force[n * dim + dof] - previous_residual_force[n * dim + dof];
+            quotient[0] -= owned_node[n] * du * delta_r;
+            quotient[1] += owned_node[n] * lumped_mass(n) * du * du;
+          }
+        }
+#ifdef NIMBLE_HAVE_MPI
+        double quotient_local[2] = {quotient[0], quotient[1]};
+        MPI_Allreduce(quotient_local, quotient, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+        damping = 0.0;
+        if (quotient[0] > 0.0 && quotient[1] > 0.0) {
+          damping = std::min(2.0 * std::sqrt(quotient[0] / quotient[1]), 1.9 / h);
+        }
+      }
+
+      // A = M^{-1} R
+      for (int n = 0; n < num_nodes; ++n) {
+        const double oneOverM = 1.0 / lumped_mass(n);
+        for (int dof = 0; dof < dim; ++dof) { acceleration(n, dof) = oneOverM * residual_force[n * dim + dof]; }
+      }
+
+      if (use_kinetic_damping) {
+        // V^{n+1/2} = V^{n-1/2} + h * A^{n}, V^{1/2} = (h/2) * A^{0} on a restart
+        if (restart) {
+          velocity = (0.5 * h) * acceleration;
+        } else {
+          velocity = velocity + h * acceleration;
+        }
+        restart = false;
+
+        //
+        // Kinetic damping, zero the velocities once the kinetic energy peaks
+        //
+        double new_kinetic_energy(0.0);
+        for (int n = 0; n < num_nodes; ++n) {
+          for (int dof = 0; dof < dim; ++dof) {
+            new_kinetic_energy += 0.5 * owned_node[n] * lumped_mass(n) * velocity(n, dof) * velocity(n, dof);
+          }
+        }
+#ifdef NIMBLE_HAVE_MPI
+        double ke_local = new_kinetic_energy;
+        MPI_Allreduce(&ke_local, &new_kinetic_energy, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+        if (new_kinetic_energy < kinetic_energy) {
+          velocity.zero();
+          new_kinetic_energy = 0.0;
+          restart            = true;
+        }
+        kinetic_energy = new_kinetic_energy;
+
+        model_data.UpdateWithNewVelocity(data_manager, h);
+
+        // U^{n+1} = U^{n} + h * V^{n+1/2}
+        displacement += h * velocity;
+      } else {
+        // V^{n+1/2} = ((2 - c h) V^{n-1/2} + 2 h A^{n}) / (2 + c h), V^{1/2} = (h/2) * A^{0}
+        // on a restart, and U^{n+1} = U^{n} + h * V^{n+1/2} in the same pass
+        if (restart) {
+          nimble::FusedAssign(velocity, (0.5 * h) * acceleration, displacement, displacement + h * velocity);
+        } else {
+          const double scale = 1.0 / (2.0 + damping * h);
+          nimble::FusedAssign(
+              velocity,
+              scale * ((2.0 - damping * h) * velocity + (2.0 * h) * acceleration),
+              displacement,
+              displacement + h * velocity);
+        }
+        restart = false;
+
+        model_data.UpdateWithNewVelocity(data_manager, h);
+      }
+
+      model_data.UpdateWithNewDisplacement(data_manager, h);
+
+      std::swap(residual_force, previous_residual_force);
+      residual = ComputeDynamicRelaxationResidual(
+          data_manager, time_previous, time_current, is_output_step, free_dof, owned_node, residual_force);
+
+      iteration += 1;
+    }
+
+    if (my_rank == 0) {
+      std::cout << "\nStep " << step + 1 << std::scientific << std::setprecision(3) << ", time " << time_current
+                << ", convergence tolerance " << convergence_tolerance << std::endl;
+      std::cout << "  " << iteration << " iterations: residual = " << residual << std::endl;
+    }
+
+    if (residual > convergence_tolerance) {
+      if (my_rank == 0) {
+        std::cout << "\n**** Dynamic relaxation failed to converge!\n" << std::endl;
+        std::cout << "**** Relevant input deck parameters for dynamic relaxation:" << std::endl;
+        std::cout << "****   nonlinear solver relative tolerance:      " << relative_tolerance << std::endl;
+        std::cout << "****   dynamic relaxation maximum iterations:    " << max_iterations << std::endl;
+      }
+      status = 1;
+      return status;
+    }
+
+    if (is_output_step) data_manager.WriteOutput(time_current);
+
+    model_data.UpdateStates(data_manager);
+  }
+
   if (my_rank == 0) { std::cout << "\nComplete.\n" << std::endl; }
 
   return status;
 }
 
 double
-ComputeQuasistaticResidual(
-    nimble::GenesisMesh&              mesh,
-    nimble::DataManager&              data_manager,
-    nimble::BoundaryConditionManager& bc,
-    int                               linear_system_num_unknowns,
-    std::vector<int>&                 linear_system_global_node_ids,
-    double                            time_previous,
-    double                            time_current,
-    const nimble::Viewify<2>&         displacement,
-    nimble::Viewify<2>&               internal_force,
-    double*                           residual_vector,
-    bool                              is_output_step)
+ComputeDynamicRelaxationResidual(
+    nimble::DataManager&       data_manager,
+    double                     time_previous,
+    double                     time_current,
+    bool                       is_output_step,
+    const std::vector<double>& free_dof,
+    const std::vector<double>& owned_node,
+    std::vector<double>&       residual_force)
 {
-  const int dim          = mesh.GetDim();
-  const int num_nodes    = static_cast<int>(mesh.GetNumNodes());
-  const int num_unknowns = num_nodes * mesh.GetDim();
-
   auto model_data = data_manager.GetModelData();
 
+  auto displacement   = model_data->GetVectorNodeData("displacement");
+  auto internal_force = model_data->GetVectorNodeData("internal_force");
+  auto external_force = model_data->GetVectorNodeData("external_force");
+
+  const int num_nodes = static_cast<int>(data_manager.GetMesh().GetNumNodes());
+  const int dim       = data_manager.GetMesh().GetDim();
+
+  model_data->ComputeExternalForce(data_manager, time_previous, time_current, is_output_step);
   model_data->ComputeInternalForce(
       data_manager, time_previous, time_current, is_output_step, displacement, internal_force);
 
-  for (int i = 0; i < linear_system_num_unknowns; i++) residual_vector[i] = 0.0;
-
+  double l2_norm(0.0);
   for (int n = 0; n < num_nodes; n++) {
-    int ls_id = linear_system_global_node_ids[n];
     for (int dof = 0; dof < dim; dof++) {
-      int ls_index = ls_id * dim + dof;
-#ifdef NIMBLE_DEBUG
-      if (ls_index < 0 || ls_index > linear_system_num_unknowns - 1) {
-        throw std::invalid_argument(
-            "\nError:  Invalid index into residual vector in "
-            "QuasistaticTimeIntegrator().\n");
-      }
-#endif
-      residual_vector[ls_index] += -1.0 * internal_force(n, dof);
+      const double force            = free_dof[n * dim + dof] * (internal_force(n, dof) + external_force(n, dof));
+      residual_force[n * dim + dof] = force;
+      l2_norm += owned_node[n] * force * force;
     }
   }
-  bc.ModifyRHSForKinematicBC(linear_system_global_node_ids.data(), residual_vector);
+#ifdef NIMBLE_HAVE_MPI
+  double restmp = l2_norm;
+  MPI_Allreduce(&restmp, &l2_norm, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  return std::sqrt(l2_norm);
+}
+
+void
+UpdateDisplacement(
+    const LinearSystemDofMap&  dof_map,
+    double                     coefficient,
+    const std::vector<double>& linear_solver_solution,
+    const nimble::Viewify<2>&  displacement,
+    nimble::Viewify<2>&        new_displacement)
+{
+  dof_map.Scatter(coefficient, linear_solver_solution.data(), displacement, new_displacement);
+}
+
+double
+ComputeQuasistaticResidual(
+    nimble::GenesisMesh&      mesh,
+    nimble::DataManager&      data_manager,
+    const LinearSystemDofMap& dof_map,
+    double                    time_previous,
+    double                    time_current,
+    const nimble::Viewify<2>& displacement,
+    nimble::Viewify<2>&       internal_force,
+    double*                   residual_vector,
+    bool                      is_output_step,
+    const NewmarkData*        inertia)
+{
+  const int num_unknowns = static_cast<int>(mesh.GetNumNodes()) * dof_map.dim;
+
+  auto model_data = data_manager.GetModelData();
+
+  model_data->ComputeInternalForce(
+      data_manager, time_previous, time_current, is_output_step, displacement, internal_force);
+
+  // R = -F, every linear system entry is written once
+  dof_map.Gather(-1.0, internal_force, residual_vector);
+  if (inertia != nullptr) {
+    inertia->AddInertialResidual(displacement, internal_force, dof_map.linear_system_node_ids.data(), residual_vector);
+  }
+  dof_map.ZeroConstrainedDof(residual_vector);
 
-  double l2_norm = InnerProduct(num_nodes, residual_vector, residual_vector);
-  l2_norm        = sqrt(l2_norm);
+  nimble::Viewify<1> residual_view(residual_vector, num_unknowns);
+  double             l2_norm = nimble::Dot(residual_view, residual_view);
 
   double infinity_norm(0.0);
-  for (int i = 0; i < num_nodes; i++) { infinity_norm = std::max(infinity_norm, std::abs(residual_vector[i])); }
+  for (int i = 0; i < num_unknowns; i++) { infinity_norm = std::max(infinity_norm, std::abs(residual_vector[i])); }
 #ifdef NIMBLE_HAVE_MPI
-  double restmp = infinity_norm;
+  double restmp = l2_norm;
+  MPI_Allreduce(&restmp, &l2_norm, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  restmp = infinity_norm;
   MPI_Allreduce(&restmp, &infinity_norm, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #endif
 
-  double residual = l2_norm + 20.0 * infinity_norm;
+  double residual = std::sqrt(l2_norm) + 20.0 * infinity_norm;
   return residual;
 }
 
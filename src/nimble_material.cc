@@ -41,6 +41,8 @@
 //@HEADER
 */
 
+#include <nimble_element_traits.h>
+#include <nimble_macros.h>
 #include <nimble_material.h>
 #include <nimble_material_factory.h>
 
@@ -48,6 +50,78 @@
 
 namespace nimble {
 
+void
+Material::GetStressBatch(
+    int           num_lanes,
+    const int*    elem_ids,
+    int           num_pts,
+    double        time_previous,
+    double        time_current,
+    const double* deformation_gradient_n,
+    const double* deformation_gradient_np1,
+    const double* stress_n,
+    double*       stress_np1,
+    const double* state_data_n,
+    double*       state_data_np1,
+    DataManager&  data_manager,
+    bool          is_output_step)
+{
+  constexpr int width          = NIMBLE_ELEMENT_BATCH_WIDTH;
+  constexpr int max_def_grad   = 9 * MaxElementTopology::num_int_pts;
+  constexpr int max_stress     = 6 * MaxElementTopology::num_int_pts;
+  constexpr int max_state_data = MAX_NUM_STATE_VARIABLES * MaxElementTopology::num_int_pts;
+  const int     def_grad_size  = 9 * num_pts;
+  const int     stress_size    = 6 * num_pts;
+  const int     num_state_data = NumStateVariables() * num_pts;
+  NIMBLE_ASSERT(
+      num_pts <= MaxElementTopology::num_int_pts && num_state_data <= max_state_data,
+      "\n**** Error in Material::GetStressBatch(), batch larger than the stack scratch.\n");
+
+  // One row per lane, filled by a single pass over the element-minor entries
+  double def_grad_n[width][max_def_grad], def_grad_np1[width][max_def_grad];
+  double sig_n[width][max_stress], sig_np1[width][max_stress];
+  double state_n[width][max_state_data], state_np1[width][max_state_data];
+  for (int i = 0; i < def_grad_size; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) {
+      def_grad_n[lane][i]   = deformation_gradient_n[i * width + lane];
+      def_grad_np1[lane][i] = deformation_gradient_np1[i * width + lane];
+    }
+  }
+  for (int i = 0; i < stress_size; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) { sig_n[lane][i] = stress_n[i * width + lane]; }
+  }
+  for (int i = 0; i < num_state_data; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) { state_n[lane][i] = state_data_n[i * width + lane]; }
+  }
+
+  for (int lane = 0; lane < num_lanes; lane++) {
+    GetStress(
+        elem_ids[lane],
+        num_pts,
+        time_previous,
+        time_current,
+        def_grad_n[lane],
+        def_grad_np1[lane],
+        sig_n[lane],
+        sig_np1[lane],
+        num_state_data > 0 ? state_n[lane] : nullptr,
+        num_state_data > 0 ? state_np1[lane] : nullptr,
+        data_manager,
+        is_output_step);
+  }
+
+  for (int i = 0; i < stress_size; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) { stress_np1[i * width + lane] = sig_np1[lane][i]; }
+  }
+  for (int i = 0; i < num_state_data; i++) {
+    for (int lane = 0; lane < num_lanes; lane++) { state_data_np1[i * width + lane] = state_np1[lane][i]; }
+  }
+}
+
+static_assert(
+    J2PlasticityMaterial::NUM_STATE_VARIABLES <= Material::MAX_NUM_STATE_VARIABLES,
+    "Material::MAX_NUM_STATE_VARIABLES too small for J2PlasticityMaterial");
+
 void
 ElasticMaterial::register_supported_material_parameters(MaterialFactoryBase& factory)
 {
@@ -125,6 +199,58 @@ ElasticMaterial::GetStress(
   stress_np1(K_S_ZX) = two_mu * strain[K_S_ZX];
 }
 
+void
+ElasticMaterial::GetStressBatch(
+    int           num_lanes,
+    const int*    /* elem_ids */,
+    int           num_pts,
+    double        /* time_previous */,
+    double        /* time_current */,
+    const double* /* deformation_gradient_n */,
+    const double* deformation_gradient_np1,
+    const double* /* stress_n */,
+    double*       stress_np1,
+    const double* /* state_data_n */,
+    double*       /* state_data_np1 */,
+    DataManager&  /* data_manager */,
+    bool          /* is_output_step */)
+{
+  GetStressLanes(num_lanes, num_pts, deformation_gradient_np1, stress_np1);
+}
+
+void
+ElasticMaterial::GetStressLanes(
+    int           num_lanes,
+    int           num_pts,
+    const double* deformation_gradient_np1,
+    double*       stress_np1) const
+{
+  constexpr int width  = NIMBLE_ELEMENT_BATCH_WIDTH;
+  const double  two_mu = 2.0 * shear_modulus_;
+  const double  lambda = bulk_modulus_ - 2.0 * shear_modulus_ / 3.0;
+
+  for (int pt = 0; pt < num_pts; pt++) {
+    const double* def_grad = &deformation_gradient_np1[9 * pt * width];
+    double*       stress   = &stress_np1[6 * pt * width];
+    for (int lane = 0; lane < num_lanes; lane++) {
+      double strain_xx    = def_grad[K_F_XX * width + lane] - 1.0;
+      double strain_yy    = def_grad[K_F_YY * width + lane] - 1.0;
+      double strain_zz    = def_grad[K_F_ZZ * width + lane] - 1.0;
+      double strain_xy    = 0.5 * (def_grad[K_F_XY * width + lane] + def_grad[K_F_YX * width + lane]);
+      double strain_yz    = 0.5 * (def_grad[K_F_YZ * width + lane] + def_grad[K_F_ZY * width + lane]);
+      double strain_zx    = 0.5 * (def_grad[K_F_ZX * width + lane] + def_grad[K_F_XZ * width + lane]);
+      double trace_strain = strain_xx + strain_yy + strain_zz;
+
+      stress[K_S_XX * width + lane] = two_mu * strain_xx + lambda * trace_strain;
+      stress[K_S_YY * width + lane] = two_mu * strain_yy + lambda * trace_strain;
+      stress[K_S_ZZ * width + lane] = two_mu * strain_zz + lambda * trace_strain;
+      stress[K_S_XY * width + lane] = two_mu * strain_xy;
+      stress[K_S_YZ * width + lane] = two_mu * strain_yz;
+      stress[K_S_ZX * width + lane] = two_mu * strain_zx;
+    }
+  }
+}
+
 #ifdef NIMBLE_HAVE_UQ
 void
 ElasticMaterial::GetOffNominalStress(
@@ -260,40 +386,24 @@ NeohookeanMaterial::GetStress(
 {
   double xj, fac, pressure, bxx, byy, bzz, bxy, byz, bzx, trace;
 
-  // left stretch and rotation
-  double v[6], r[9];
-  Polar_Decomp(deformation_gradient_np1.data(), v, r);
+  // b = F F^T equals V V, so no polar decomposition is needed here
+  const double* def_grad = deformation_gradient_np1.data();
+  CheckVectorSanity(9, def_grad, "neohookean deformation_gradient_np1");
 
-  CheckVectorSanity(9, deformation_gradient_np1.data(), "neohookean deformation_gradient_np1");
-  CheckVectorSanity(6, v, "neohookean v");
-  CheckVectorSanity(9, r, "neohookean r");
-
-  xj = v[K_S_XX] * v[K_S_YY] * v[K_S_ZZ] + 2.0 * v[K_S_XY] * v[K_S_YZ] * v[K_S_ZX] - v[K_S_XX] * v[K_S_YZ] * v[K_S_YZ] -
-       v[K_S_YY] * v[K_S_ZX] * v[K_S_ZX] - v[K_S_ZZ] * v[K_S_XY] * v[K_S_XY];
+  double b[6];
+  xj = LeftCauchyGreen_Full33(def_grad, b);
 
   double cbrt_xj = std::cbrt(xj);
   fac            = 1.0 / (cbrt_xj * cbrt_xj);
 
   pressure = 0.5 * bulk_modulus_ * (xj - 1.0 / xj);
 
-  bxx = v[K_S_XX] * v[K_S_XX] + v[K_S_XY] * v[K_S_YX] + v[K_S_XZ] * v[K_S_ZX];
-
-  byy = v[K_S_YX] * v[K_S_XY] + v[K_S_YY] * v[K_S_YY] + v[K_S_YZ] * v[K_S_ZY];
-
-  bzz = v[K_S_ZX] * v[K_S_XZ] + v[K_S_ZY] * v[K_S_YZ] + v[K_S_ZZ] * v[K_S_ZZ];
-
-  bxy = v[K_S_XX] * v[K_S_XY] + v[K_S_XY] * v[K_S_YY] + v[K_S_XZ] * v[K_S_ZY];
-
-  byz = v[K_S_YX] * v[K_S_XZ] + v[K_S_YY] * v[K_S_YZ] + v[K_S_YZ] * v[K_S_ZZ];
-
-  bzx = v[K_S_ZX] * v[K_S_XX] + v[K_S_ZY] * v[K_S_YX] + v[K_S_ZZ] * v[K_S_ZX];
-
-  bxx = fac * bxx;
-  byy = fac * byy;
-  bzz = fac * bzz;
-  bxy = fac * bxy;
-  byz = fac * byz;
-  bzx = fac * bzx;
+  bxx = fac * b[K_S_XX];
+  byy = fac * b[K_S_YY];
+  bzz = fac * b[K_S_ZZ];
+  bxy = fac * b[K_S_XY];
+  byz = fac * b[K_S_YZ];
+  bzx = fac * b[K_S_ZX];
 
   trace = bxx + byy + bzz;
 
@@ -309,6 +419,56 @@ NeohookeanMaterial::GetStress(
   stress_np1(K_S_ZX) = shear_modulus_ * bzx / xj;
 }
 
+void
+NeohookeanMaterial::GetStressBatch(
+    int           num_lanes,
+    const int*    /* elem_ids */,
+    int           num_pts,
+    double        /* time_previous */,
+    double        /* time_current */,
+    const double* /* deformation_gradient_n */,
+    const double* deformation_gradient_np1,
+    const double* /* stress_n */,
+    double*       stress_np1,
+    const double* /* state_data_n */,
+    double*       /* state_data_np1 */,
+    DataManager&  /* data_manager */,
+    bool          /* is_output_step */)
+{
+  GetStressLanes(num_lanes, num_pts, deformation_gradient_np1, stress_np1);
+}
+
+void
+NeohookeanMaterial::GetStressLanes(
+    int           num_lanes,
+    int           num_pts,
+    const double* deformation_gradient_np1,
+    double*       stress_np1) const
+{
+  constexpr int width = NIMBLE_ELEMENT_BATCH_WIDTH;
+
+  for (int pt = 0; pt < num_pts; pt++) {
+    const double* def_grad = &deformation_gradient_np1[9 * pt * width];
+    double*       sig      = &stress_np1[6 * pt * width];
+    for (int lane = 0; lane < num_lanes; lane++) {
+      double f[9], b[6];
+      for (int k = 0; k < 9; k++) { f[k] = def_grad[k * width + lane]; }
+      double xj       = LeftCauchyGreen_Full33(f, b);
+      double cbrt_xj  = std::cbrt(xj);
+      double fac      = 1.0 / (cbrt_xj * cbrt_xj);
+      double pressure = 0.5 * bulk_modulus_ * (xj - 1.0 / xj);
+      double trace    = fac * (b[K_S_XX] + b[K_S_YY] + b[K_S_ZZ]);
+
+      sig[K_S_XX * width + lane] = pressure + shear_modulus_ * (fac * b[K_S_XX] - trace / 3.0) / xj;
+      sig[K_S_YY * width + lane] = pressure + shear_modulus_ * (fac * b[K_S_YY] - trace / 3.0) / xj;
+      sig[K_S_ZZ * width + lane] = pressure + shear_modulus_ * (fac * b[K_S_ZZ] - trace / 3.0) / xj;
+      sig[K_S_XY * width + lane] = shear_modulus_ * fac * b[K_S_XY] / xj;
+      sig[K_S_YZ * width + lane] = shear_modulus_ * fac * b[K_S_YZ] / xj;
+      sig[K_S_ZX * width + lane] = shear_modulus_ * fac * b[K_S_ZX] / xj;
+    }
+  }
+}
+
 #ifdef NIMBLE_HAVE_UQ
 void
 NeohookeanMaterial::GetOffNominalStress(
@@ -388,4 +548,239 @@ NeohookeanMaterial::GetTangent(int num_pts, double* material_tangent) const
     material_tangent[offset + 35] = mu;
   }
 }
+
+void
+J2PlasticityMaterial::register_supported_material_parameters(MaterialFactoryBase& factory)
+{
+  factory.add_valid_double_parameter_name("bulk_modulus");
+  factory.add_valid_double_parameter_name("shear_modulus");
+  factory.add_valid_double_parameter_name("density");
+  factory.add_valid_double_parameter_name("yield_stress");
+  factory.add_valid_double_parameter_name("hardening_modulus");
+}
+
+J2PlasticityMaterial::J2PlasticityMaterial(MaterialParameters const& material_parameters)
+    : Material(),
+      dim_(3),
+      density_(material_parameters.GetParameterValue("density")),
+      bulk_modulus_(material_parameters.GetParameterValue("bulk_modulus")),
+      shear_modulus_(material_parameters.GetParameterValue("shear_modulus")),
+      yield_stress_(material_parameters.GetParameterValue("yield_stress")),
+      hardening_modulus_(0.0)
+{
+  if (material_parameters.IsParameter("hardening_modulus")) {
+    hardening_modulus_ = material_parameters.GetParameterValue("hardening_modulus");
+  }
+}
+
+void
+J2PlasticityMaterial::GetStateVariableLabel(int index, char label[MaterialParameters::MAX_MAT_MODEL_STR_LEN]) const
+{
+  const char* labels[NUM_STATE_VARIABLES] = {
+      "be_bar_11", "be_bar_22", "be_bar_33", "be_bar_12", "be_bar_23", "be_bar_31", "eqps"};
+  if (index < 0 || index >= NUM_STATE_VARIABLES) {
+    printf(
+        "\n**** Error, bad index in "
+        "J2PlasticityMaterial::GetStateVariableLabel().\n");
+    return;
+  }
+  int i = 0;
+  for (; labels[index][i] != '\0' && i < MaterialParameters::MAX_MAT_MODEL_STR_LEN - 1; i++) {
+    label[i] = labels[index][i];
+  }
+  label[i] = '\0';
+}
+
+double
+J2PlasticityMaterial::GetStateVariableInitialValue(int index) const
+{
+  // undeformed elastic left Cauchy-Green tensor is the identity
+  return (index < 3) ? 1.0 : 0.0;
+}
+
+void
+J2PlasticityMaterial::RadialReturn(
+    const double* deformation_gradient_n,
+    const double* deformation_gradient_np1,
+    const double* state_data_n,
+    double*       stress_np1,
+    double*       state_data_np1) const
+{
+  const double sqrt_two_thirds = std::sqrt(2.0 / 3.0);
+
+  // isochoric part of the relative deformation gradient
+  double def_grad_n_inv[9], def_grad_rel[9], def_grad_rel_bar[9];
+  Invert_Full33(deformation_gradient_n, def_grad_n_inv);
+  Mult_Full33_Full33(deformation_gradient_np1, def_grad_n_inv, def_grad_rel);
+  double cbrt_j_rel = std::cbrt(Determinant_Full33(def_grad_rel));
+  Mult_Scalar_Full33(1.0 / cbrt_j_rel, def_grad_rel, def_grad_rel_bar);
+
+  // trial elastic state, be_bar_trial = f_bar be_bar_n f_bar^T
+  double temp[9], be_trial[9];
+  Mult_Full33_Sym33_ReturnT(def_grad_rel_bar, state_data_n, temp);
+  Mult_Full33_Full33(def_grad_rel_bar, temp, be_trial);
+
+  double ie = (be_trial[K_F_XX] + be_trial[K_F_YY] + be_trial[K_F_ZZ]) / 3.0;
+
+  // deviatoric Kirchhoff stress
+  double s[6];
+  s[K_S_XX] = shear_modulus_ * (be_trial[K_F_XX] - ie);
+  s[K_S_YY] = shear_modulus_ * (be_trial[K_F_YY] - ie);
+  s[K_S_ZZ] = shear_modulus_ * (be_trial[K_F_ZZ] - ie);
+  s[K_S_XY] = shear_modulus_ * 0.5 * (be_trial[K_F_XY] + be_trial[K_F_YX]);
+  s[K_S_YZ] = shear_modulus_ * 0.5 * (be_trial[K_F_YZ] + be_trial[K_F_ZY]);
+  s[K_S_ZX] = shear_modulus_ * 0.5 * (be_trial[K_F_ZX] + be_trial[K_F_XZ]);
+
+  double s_norm = std::sqrt(
+      s[K_S_XX] * s[K_S_XX] + s[K_S_YY] * s[K_S_YY] + s[K_S_ZZ] * s[K_S_ZZ] +
+      2.0 * (s[K_S_XY] * s[K_S_XY] + s[K_S_YZ] * s[K_S_YZ] + s[K_S_ZX] * s[K_S_ZX]));
+
+  double eqps        = state_data_n[6];
+  double yield_trial = s_norm - sqrt_two_thirds * (yield_stress_ + hardening_modulus_ * eqps);
+
+  if (yield_trial > 0.0) {
+    double mu_bar = shear_modulus_ * ie;
+    double dgamma = yield_trial / (2.0 * mu_bar * (1.0 + hardening_modulus_ / (3.0 * mu_bar)));
+    double scale  = 1.0 - 2.0 * mu_bar * dgamma / s_norm;
+    for (int i = 0; i < 6; i++) { s[i] *= scale; }
+    eqps += sqrt_two_thirds * dgamma;
+  }
+
+  // be_bar_np1 = s / mu + ie I
+  for (int i = 0; i < 6; i++) { state_data_np1[i] = s[i] / shear_modulus_; }
+  state_data_np1[K_S_XX] += ie;
+  state_data_np1[K_S_YY] += ie;
+  state_data_np1[K_S_ZZ] += ie;
+  state_data_np1[6] = eqps;
+
+  // Cauchy stress
+  double xj       = Determinant_Full33(deformation_gradient_np1);
+  double pressure = 0.5 * bulk_modulus_ * (xj - 1.0 / xj);
+  for (int i = 0; i < 6; i++) { stress_np1[i] = s[i] / xj; }
+  stress_np1[K_S_XX] += pressure;
+  stress_np1[K_S_YY] += pressure;
+  stress_np1[K_S_ZZ] += pressure;
+}
+
+void
+J2PlasticityMaterial::GetStress(
+    int                 elem_id,
+    int                 num_pts,
+    double              time_previous,
+    double              time_current,
+    const double* const deformation_gradient_n,
+    const double* const deformation_gradient_np1,
+    const double* const stress_n,
+    double*             stress_np1,
+    const double* const state_data_n,
+    double*             state_data_np1,
+    DataManager&        data_manager,
+    bool                is_output_step)
+{
+  for (int pt = 0; pt < num_pts; pt++) {
+    RadialReturn(
+        &deformation_gradient_n[9 * pt],
+        &deformation_gradient_np1[9 * pt],
+        &state_data_n[NUM_STATE_VARIABLES * pt],
+        &stress_np1[6 * pt],
+        &state_data_np1[NUM_STATE_VARIABLES * pt]);
+  }
+}
+
+#ifdef NIMBLE_HAVE_KOKKOS
+void
+J2PlasticityMaterial::GetStress(
+    double                                                        time_previous,
+    double                                                        time_current,
+    const nimble_kokkos::DeviceFullTensorIntPtSingleEntryView&    deformation_gradient_n,
+    const nimble_kokkos::DeviceFullTensorIntPtSingleEntryView&    deformation_gradient_np1,
+    const nimble_kokkos::DeviceSymTensorIntPtSingleEntryView&     stress_n,
+    nimble_kokkos::DeviceSymTensorIntPtSingleEntryView            stress_np1,
+    const nimble_kokkos::DeviceStateVariableIntPtSingleEntryView& state_data_n,
+    nimble_kokkos::DeviceStateVariableIntPtSingleEntryView        state_data_np1) const
+{
+  // the state variable views are strided, work on local copies
+  double def_grad_n[9], def_grad_np1[9], sig[6];
+  double state_n[NUM_STATE_VARIABLES], state_np1[NUM_STATE_VARIABLES];
+  for (int i = 0; i < 9; i++) {
+    def_grad_n[i]   = deformation_gradient_n(i);
+    def_grad_np1[i] = deformation_gradient_np1(i);
+  }
+  for (int i = 0; i < NUM_STATE_VARIABLES; i++) { state_n[i] = state_data_n(i); }
+
+  RadialReturn(def_grad_n, def_grad_np1, state_n, sig, state_np1);
+
+  for (int i = 0; i < 6; i++) { stress_np1(i) = sig[i]; }
+  for (int i = 0; i < NUM_STATE_VARIABLES; i++) { state_data_np1(i) = state_np1[i]; }
+}
+#endif
+
+void
+J2PlasticityMaterial::GetStress(
+    double                            time_previous,
+    double                            time_current,
+    nimble::Viewify<1, const double>& deformation_gradient_n,
+    nimble::Viewify<1, const double>& deformation_gradient_np1,
+    nimble::Viewify<1, const double>& stress_n,
+    nimble::Viewify<1>                stress_np1) const
+{
+  double identity[9] = {1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  double state_n[NUM_STATE_VARIABLES], state_np1[NUM_STATE_VARIABLES], sig[6];
+  for (int i = 0; i < NUM_STATE_VARIABLES; i++) { state_n[i] = GetStateVariableInitialValue(i); }
+
+  RadialReturn(identity, deformation_gradient_np1.data(), state_n, sig, state_np1);
+
+  for (int i = 0; i < 6; i++) { stress_np1(i) = sig[i]; }
+}
+
+#ifdef NIMBLE_HAVE_UQ
+void
+J2PlasticityMaterial::GetOffNominalStress(
+    const double& bulk_mod,
+    const double& shear_mod,
+    int           num_pts,
+    const double* deformation_gradient_np1,
+    double*       stress_np1)
+{
+  //--- Copy current values for bulk and shear moduli
+  double old_bulk  = bulk_modulus_;
+  double old_shear = shear_modulus_;
+
+  bulk_modulus_  = bulk_mod;
+  shear_modulus_ = shear_mod;
+
+  // Cauchy stress
+  double*                          sig = stress_np1;
+  nimble::Viewify<1, const double> null_view;
+
+  for (int pt = 0; pt < num_pts; pt++) {
+    nimble::Viewify<1, const double> def_grad_view(&deformation_gradient_np1[9 * pt], 9);
+    GetStress(0.0, 0.0, null_view, def_grad_view, null_view, {sig, 6});
+    sig += 6;
+  }
+
+  //--- Reset bulk and shear moduli
+  bulk_modulus_  = old_bulk;
+  shear_modulus_ = old_shear;
+}
+#endif
+
+void
+J2PlasticityMaterial::GetTangent(int num_pts, double* material_tangent) const
+{
+  // elastic tangent, used by the implicit solvers as a secant approximation
+  double lambda = bulk_modulus_ - 2.0 * shear_modulus_ / 3.0;
+  double mu     = shear_modulus_;
+  double two_mu = 2.0 * shear_modulus_;
+
+  for (int int_pt = 0; int_pt < num_pts; int_pt++) {
+    double* tangent = material_tangent + int_pt * 36;
+    for (int i = 0; i < 36; i++) { tangent[i] = 0.0; }
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++) { tangent[6 * i + j] = lambda; }
+      tangent[6 * i + i] = lambda + two_mu;
+      tangent[6 * (i + 3) + i + 3] = mu;
+    }
+  }
+}
 }  // namespace nimble
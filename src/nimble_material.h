@@ -196,6 +196,9 @@ class MaterialParameters
 class Material
 {
  public:
+  /// Largest NumStateVariables() supported by the default GetStressBatch
+  static constexpr int MAX_NUM_STATE_VARIABLES = 8;
+
   NIMBLE_FUNCTION
   Material() = default;
 
@@ -252,6 +255,28 @@ class Material
       DataManager&  data_manager,
       bool          is_output_step) = 0;
 
+  /// \brief Stress update of up to NIMBLE_ELEMENT_BATCH_WIDTH elements at once
+  ///
+  /// Same arguments as GetStress, one lane per element, with every per point
+  /// array stored element-minor (entry i of lane l at [i * NIMBLE_ELEMENT_BATCH_WIDTH + l]).
+  /// The default calls GetStress for each lane, transposing through stack
+  /// scratch sized by MaxElementTopology and MAX_NUM_STATE_VARIABLES.
+  virtual void
+  GetStressBatch(
+      int           num_lanes,
+      const int*    elem_ids,
+      int           num_pts,
+      double        time_previous,
+      double        time_current,
+      const double* deformation_gradient_n,
+      const double* deformation_gradient_np1,
+      const double* stress_n,
+      double*       stress_np1,
+      const double* state_data_n,
+      double*       state_data_np1,
+      DataManager&  data_manager,
+      bool          is_output_step);
+
 #ifdef NIMBLE_HAVE_KOKKOS
   NIMBLE_FUNCTION
   virtual void
@@ -270,6 +295,24 @@ class Material
     nimble::Viewify<1>               s_np1(stress_np1.data(), stress_len);
     GetStress(time_previous, time_current, def_g_n, def_g_np1, s_n, s_np1);
   }
+
+  /// \brief Device stress update for models with state variables
+  ///
+  /// The default ignores the state variables, history-dependent models override it.
+  NIMBLE_FUNCTION
+  virtual void
+  GetStress(
+      double                                                        time_previous,
+      double                                                        time_current,
+      const nimble_kokkos::DeviceFullTensorIntPtSingleEntryView&    deformation_gradient_n,
+      const nimble_kokkos::DeviceFullTensorIntPtSingleEntryView&    deformation_gradient_np1,
+      const nimble_kokkos::DeviceSymTensorIntPtSingleEntryView&     stress_n,
+      nimble_kokkos::DeviceSymTensorIntPtSingleEntryView            stress_np1,
+      const nimble_kokkos::DeviceStateVariableIntPtSingleEntryView& state_data_n,
+      nimble_kokkos::DeviceStateVariableIntPtSingleEntryView        state_data_np1) const
+  {
+    GetStress(time_previous, time_current, deformation_gradient_n, deformation_gradient_np1, stress_n, stress_np1);
+  }
 #endif
 
   NIMBLE_FUNCTION
@@ -374,6 +417,26 @@ class ElasticMaterial : public Material
       DataManager&  data_manager,
       bool          is_output_step) override;
 
+  void
+  GetStressBatch(
+      int           num_lanes,
+      const int*    elem_ids,
+      int           num_pts,
+      double        time_previous,
+      double        time_current,
+      const double* deformation_gradient_n,
+      const double* deformation_gradient_np1,
+      const double* stress_n,
+      double*       stress_np1,
+      const double* state_data_n,
+      double*       state_data_np1,
+      DataManager&  data_manager,
+      bool          is_output_step) override;
+
+  /// \brief Stress of num_lanes elements, the per point arrays stored element-minor as in GetStressBatch
+  void
+  GetStressLanes(int num_lanes, int num_pts, const double* deformation_gradient_np1, double* stress_np1) const;
+
   NIMBLE_FUNCTION
   void
   GetTangent(int num_pts, double* material_tangent) const override;
@@ -483,6 +546,26 @@ class NeohookeanMaterial : public Material
       DataManager&  data_manager,
       bool          is_output_step) override;
 
+  void
+  GetStressBatch(
+      int           num_lanes,
+      const int*    elem_ids,
+      int           num_pts,
+      double        time_previous,
+      double        time_current,
+      const double* deformation_gradient_n,
+      const double* deformation_gradient_np1,
+      const double* stress_n,
+      double*       stress_np1,
+      const double* state_data_n,
+      double*       state_data_np1,
+      DataManager&  data_manager,
+      bool          is_output_step) override;
+
+  /// \brief Stress of num_lanes elements, the per point arrays stored element-minor as in GetStressBatch
+  void
+  GetStressLanes(int num_lanes, int num_pts, const double* deformation_gradient_np1, double* stress_np1) const;
+
   NIMBLE_FUNCTION
   void
   GetTangent(int num_pts, double* material_tangent) const override;
@@ -517,6 +600,140 @@ class NeohookeanMaterial : public Material
   double shear_modulus_;
 };
 
+
+/// \brief Finite strain J2 plasticity with linear isotropic hardening
+///
+/// Multiplicative split with the volume-preserving elastic left Cauchy-Green
+/// tensor as state (Simo, 1988), the neohookean volumetric response and a radial
+/// return on the deviatoric Kirchhoff stress. State variables are the six
+/// components of the isochoric elastic left Cauchy-Green tensor and the
+/// equivalent plastic strain.
+class J2PlasticityMaterial : public Material
+{
+ public:
+  static constexpr int NUM_STATE_VARIABLES = 7;
+
+  static void
+  register_supported_material_parameters(MaterialFactoryBase& factory);
+
+  NIMBLE_FUNCTION
+  J2PlasticityMaterial(const J2PlasticityMaterial& mat) = default;
+
+  NIMBLE_FUNCTION
+  explicit J2PlasticityMaterial(MaterialParameters const& material_parameters);
+
+  NIMBLE_FUNCTION
+  int
+  NumStateVariables() const override
+  {
+    return NUM_STATE_VARIABLES;
+  };
+
+  NIMBLE_FUNCTION
+  void
+  GetStateVariableLabel(int index, char label[MaterialParameters::MAX_MAT_MODEL_STR_LEN]) const override;
+
+  NIMBLE_FUNCTION
+  double
+  GetStateVariableInitialValue(int index) const override;
+
+  NIMBLE_FUNCTION
+  double
+  GetDensity() const override
+  {
+    return density_;
+  }
+
+  NIMBLE_FUNCTION
+  double
+  GetBulkModulus() const override
+  {
+    return bulk_modulus_;
+  }
+
+  NIMBLE_FUNCTION
+  double
+  GetShearModulus() const override
+  {
+    return shear_modulus_;
+  }
+
+  NIMBLE_FUNCTION
+  void
+  GetStress(
+      int           elem_id,
+      int           num_pts,
+      double        time_previous,
+      double        time_current,
+      const double* deformation_gradient_n,
+      const double* deformation_gradient_np1,
+      const double* stress_n,
+      double*       stress_np1,
+      const double* state_data_n,
+      double*       state_data_np1,
+      DataManager&  data_manager,
+      bool          is_output_step) override;
+
+#ifdef NIMBLE_HAVE_KOKKOS
+  NIMBLE_FUNCTION
+  void
+  GetStress(
+      double                                                        time_previous,
+      double                                                        time_current,
+      const nimble_kokkos::DeviceFullTensorIntPtSingleEntryView&    deformation_gradient_n,
+      const nimble_kokkos::DeviceFullTensorIntPtSingleEntryView&    deformation_gradient_np1,
+      const nimble_kokkos::DeviceSymTensorIntPtSingleEntryView&     stress_n,
+      nimble_kokkos::DeviceSymTensorIntPtSingleEntryView            stress_np1,
+      const nimble_kokkos::DeviceStateVariableIntPtSingleEntryView& state_data_n,
+      nimble_kokkos::DeviceStateVariableIntPtSingleEntryView        state_data_np1) const override;
+#endif
+
+  NIMBLE_FUNCTION
+  void
+  GetTangent(int num_pts, double* material_tangent) const override;
+
+#ifdef NIMBLE_HAVE_UQ
+  NIMBLE_FUNCTION
+  void
+  GetOffNominalStress(
+      const double& bulk_mod,
+      const double& shear_mod,
+      int           num_pts,
+      const double* deformation_gradient_np1,
+      double*       stress_np1) override;
+#endif
+
+ protected:
+  /// \brief Stress from the virgin state, used where no state variables are available
+  NIMBLE_FUNCTION
+  void
+  GetStress(
+      double                            time_previous,
+      double                            time_current,
+      nimble::Viewify<1, const double>& deformation_gradient_n,
+      nimble::Viewify<1, const double>& deformation_gradient_np1,
+      nimble::Viewify<1, const double>& stress_n,
+      nimble::Viewify<1>                stress_np1) const override;
+
+  /// \brief Radial return at a single integration point
+  NIMBLE_FUNCTION
+  void
+  RadialReturn(
+      const double* deformation_gradient_n,
+      const double* deformation_gradient_np1,
+      const double* state_data_n,
+      double*       stress_np1,
+      double*       state_data_np1) const;
+
+ private:
+  int    dim_;
+  double density_;
+  double bulk_modulus_;
+  double shear_modulus_;
+  double yield_stress_;
+  double hardening_modulus_;
+};
+
 }  // namespace nimble
 
 #endif  // NIMBLE_MATERIAL_H
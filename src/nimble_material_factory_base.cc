@@ -57,6 +57,7 @@ MaterialFactoryBase::MaterialFactoryBase()
 {
   NeohookeanMaterial::register_supported_material_parameters(*this);
   ElasticMaterial::register_supported_material_parameters(*this);
+  J2PlasticityMaterial::register_supported_material_parameters(*this);
 }
 
 std::shared_ptr<MaterialParameters>
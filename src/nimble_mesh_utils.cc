@@ -43,58 +43,148 @@
 
 #include "nimble_mesh_utils.h"
 
+#ifdef NIMBLE_HAVE_KOKKOS
+#include "nimble_kokkos_defs.h"
+#endif
+
+#include <algorithm>
+
 namespace nimble {
 
+namespace {
+
+//! Calls func(i) for i in [0, n), on the host threads when Kokkos is enabled
+template <typename Func>
 void
-DetermineTangentMatrixNonzeroStructure(
+HostParallelFor(int n, const Func& func)
+{
+#ifdef NIMBLE_HAVE_KOKKOS
+  Kokkos::parallel_for(Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, n), func);
+#else
+  for (int i = 0; i < n; i++) { func(i); }
+#endif
+}
+
+}  // namespace
+
+void
+DetermineNodeGraph(
     GenesisMesh const&      mesh,
     std::vector<int> const& linear_system_node_ids,
-    std::vector<int>&       i_index,
-    std::vector<int>&       j_index)
+    std::vector<int>&       node_first_index,
+    std::vector<int>&       node_neighbors)
 {
   std::vector<int> block_ids = mesh.GetBlockIds();
-  int              dim       = mesh.GetDim();
-  int              num_rows  = linear_system_node_ids.size() * dim;
+  int              num_nodes = linear_system_node_ids.size();
 
-  // column indexes for the nonzeros in each row
-  std::vector<std::set<int>> nonzeros(num_rows);
+  // node to element incidence, two-pass counting into compressed storage
+  std::vector<int> incidence_first_index(num_nodes + 1, 0);
+  for (auto const& block_id : block_ids) {
+    int        num_entries = mesh.GetNumElementsInBlock(block_id) * mesh.GetNumNodesPerElement(block_id);
+    int const* elem_conn   = mesh.GetConnectivity(block_id);
+    for (int i = 0; i < num_entries; i++) { incidence_first_index[linear_system_node_ids[elem_conn[i]] + 1] += 1; }
+  }
+  for (int i_node = 0; i_node < num_nodes; i_node++) {
+    incidence_first_index[i_node + 1] += incidence_first_index[i_node];
+  }
 
+  // each incidence refers to the connectivity of the element it belongs to
+  std::vector<int const*> incident_elem_conn(incidence_first_index[num_nodes]);
+  std::vector<int>        incident_elem_num_nodes(incidence_first_index[num_nodes]);
+  std::vector<int>        incidence_fill(incidence_first_index.begin(), incidence_first_index.end() - 1);
   for (auto const& block_id : block_ids) {
-    int              num_elem           = mesh.GetNumElementsInBlock(block_id);
-    int              num_nodes_per_elem = mesh.GetNumNodesPerElement(block_id);
-    std::vector<int> linear_system_dof(num_nodes_per_elem * dim);
-    int const*       elem_conn = mesh.GetConnectivity(block_id);
+    int        num_elem           = mesh.GetNumElementsInBlock(block_id);
+    int        num_nodes_per_elem = mesh.GetNumNodesPerElement(block_id);
+    int const* elem_conn          = mesh.GetConnectivity(block_id);
     for (int i_elem = 0; i_elem < num_elem; i_elem++) {
+      int const* conn = elem_conn + num_nodes_per_elem * i_elem;
       for (int i_node = 0; i_node < num_nodes_per_elem; i_node++) {
-        for (int i_dim = 0; i_dim < dim; i_dim++) {
-          linear_system_dof[i_node * dim + i_dim] =
-              linear_system_node_ids[elem_conn[num_nodes_per_elem * i_elem + i_node]] * dim + i_dim;
-        }
+        int index                      = incidence_fill[linear_system_node_ids[conn[i_node]]]++;
+        incident_elem_conn[index]      = conn;
+        incident_elem_num_nodes[index] = num_nodes_per_elem;
       }
-      int row, col;
-      for (int i = 0; i < num_nodes_per_elem * dim; i++) {
-        for (int j = 0; j < num_nodes_per_elem * dim; j++) {
-          row = linear_system_dof[i];
-          col = linear_system_dof[j];
-          nonzeros[row].insert(col);
-          nonzeros[col].insert(row);
-        }
+    }
+  }
+
+  // sorted, unique neighbors of node i_node (the node itself included)
+  auto gather_neighbors = [&](int i_node, std::vector<int>& neighbors) {
+    for (int i = incidence_first_index[i_node]; i < incidence_first_index[i_node + 1]; i++) {
+      for (int j = 0; j < incident_elem_num_nodes[i]; j++) {
+        neighbors.push_back(linear_system_node_ids[incident_elem_conn[i][j]]);
       }
     }
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+  };
+
+  // first pass counts the neighbors, second pass writes them in place
+  node_first_index.assign(num_nodes + 1, 0);
+  HostParallelFor(num_nodes, [&](int i_node) {
+    std::vector<int> neighbors;
+    gather_neighbors(i_node, neighbors);
+    node_first_index[i_node + 1] = neighbors.size();
+  });
+  for (int i_node = 0; i_node < num_nodes; i_node++) { node_first_index[i_node + 1] += node_first_index[i_node]; }
+
+  node_neighbors.resize(node_first_index[num_nodes]);
+  HostParallelFor(num_nodes, [&](int i_node) {
+    std::vector<int> neighbors;
+    gather_neighbors(i_node, neighbors);
+    std::copy(neighbors.begin(), neighbors.end(), node_neighbors.begin() + node_first_index[i_node]);
+  });
+}
+
+void
+DetermineTangentMatrixRowStructure(
+    GenesisMesh const&      mesh,
+    std::vector<int> const& linear_system_node_ids,
+    std::vector<int>&       row_first_index,
+    std::vector<int>&       j_index)
+{
+  int dim       = mesh.GetDim();
+  int num_nodes = linear_system_node_ids.size();
+  int num_rows  = num_nodes * dim;
+
+  std::vector<int> node_first_index, node_neighbors;
+  DetermineNodeGraph(mesh, linear_system_node_ids, node_first_index, node_neighbors);
+
+  // each node pair in the graph is a dim x dim block of nonzeros
+  row_first_index.resize(num_rows + 1);
+  for (int i_node = 0; i_node < num_nodes; i_node++) {
+    int row_length = (node_first_index[i_node + 1] - node_first_index[i_node]) * dim;
+    for (int i_dim = 0; i_dim < dim; i_dim++) {
+      row_first_index[i_node * dim + i_dim] = node_first_index[i_node] * dim * dim + i_dim * row_length;
+    }
   }
+  row_first_index[num_rows] = node_first_index[num_nodes] * dim * dim;
+
+  j_index.resize(row_first_index[num_rows]);
+  HostParallelFor(num_nodes, [&](int i_node) {
+    for (int i_dim = 0; i_dim < dim; i_dim++) {
+      int index = row_first_index[i_node * dim + i_dim];
+      for (int i = node_first_index[i_node]; i < node_first_index[i_node + 1]; i++) {
+        for (int j_dim = 0; j_dim < dim; j_dim++) { j_index[index++] = node_neighbors[i] * dim + j_dim; }
+      }
+    }
+  });
+}
+
+void
+DetermineTangentMatrixNonzeroStructure(
+    GenesisMesh const&      mesh,
+    std::vector<int> const& linear_system_node_ids,
+    std::vector<int>&       i_index,
+    std::vector<int>&       j_index)
+{
+  std::vector<int> row_first_index;
+  DetermineTangentMatrixRowStructure(mesh, linear_system_node_ids, row_first_index, j_index);
 
   // i_index and j_index are arrays containing the row and column indices,
   // respectively, for each nonzero
-  int num_entries(0);
-  for (int i_row = 0; i_row < num_rows; i_row++) { num_entries += nonzeros[i_row].size(); }
-  i_index.resize(num_entries);
-  j_index.resize(num_entries);
-  int index(0);
+  int num_rows = static_cast<int>(row_first_index.size()) - 1;
+  i_index.resize(j_index.size());
   for (int i_row = 0; i_row < num_rows; i_row++) {
-    for (auto const& entry : nonzeros[i_row]) {
-      i_index[index]   = i_row;
-      j_index[index++] = entry;
-    }
+    for (int i = row_first_index[i_row]; i < row_first_index[i_row + 1]; i++) { i_index[i] = i_row; }
   }
 }
 
@@ -52,6 +52,32 @@
 
 namespace nimble {
 
+/// \brief Node to node adjacency of the mesh in compressed row storage
+///
+/// \param mesh Mesh
+/// \param linear_system_node_ids Linear system id of each mesh node
+/// \param node_first_index Offset of the first neighbor of each linear system node (num_nodes + 1 entries)
+/// \param node_neighbors Sorted linear system ids of the neighbors, each node is its own neighbor
+void
+DetermineNodeGraph(
+    GenesisMesh const&      mesh,
+    std::vector<int> const& linear_system_node_ids,
+    std::vector<int>&       node_first_index,
+    std::vector<int>&       node_neighbors);
+
+/// \brief Compressed row structure of the tangent stiffness matrix
+///
+/// \param mesh Mesh
+/// \param linear_system_node_ids Linear system id of each mesh node
+/// \param row_first_index Offset of the first nonzero of each row (num_rows + 1 entries)
+/// \param j_index Sorted column index of each nonzero
+void
+DetermineTangentMatrixRowStructure(
+    GenesisMesh const&      mesh,
+    std::vector<int> const& linear_system_node_ids,
+    std::vector<int>&       row_first_index,
+    std::vector<int>&       j_index);
+
 void
 DetermineTangentMatrixNonzeroStructure(
     GenesisMesh const&      mesh,
@@ -45,6 +45,8 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <limits>
 #include <sstream>
 
 #include "nimble_data_manager.h"
@@ -163,8 +165,8 @@ ModelData::AllocateElementData(std::map<int, int> const& num_integration_points_
     output_element_component_labels_[block_id]    = std::vector<std::string>();
     derived_output_element_data_labels_[block_id] = std::vector<std::string>();
     int array_length            = array_length_for_each_int_point * num_integration_points_in_each_block.at(block_id);
-    element_data_n_[block_id]   = std::vector<double>(array_length);
-    element_data_np1_[block_id] = std::vector<double>(array_length);
+    element_data_n_[block_id]   = std::vector<StateScalar>(array_length);
+    element_data_np1_[block_id] = std::vector<StateScalar>(array_length);
   }
 }
 
@@ -191,23 +193,32 @@ ModelData::GetElementDataForOutput(std::map<int, std::vector<std::vector<double>
     unsigned int num_element_variables = element_component_labels_.at(block_id).size();
     unsigned int num_output_variables  = output_element_component_labels_for_this_block.size();
     unsigned int array_size            = element_data_np1_.at(block_id).size() / num_element_variables;
+    if (num_output_variables == 0) { continue; }
+
+    // Determine the offsets into the element data array once, the labels do
+    // not change after the output fields have been specified
+    std::vector<int>& offsets = output_element_component_offsets_[block_id];
+    if (offsets.size() != num_output_variables) {
+      offsets.assign(num_output_variables, -1);
+      for (unsigned int output_array_index = 0; output_array_index < num_output_variables; output_array_index++) {
+        std::string const& output_label = output_element_component_labels_for_this_block[output_array_index];
+        for (unsigned int i = 0; i < element_component_labels_[block_id].size(); i++) {
+          if (output_label == element_component_labels_[block_id][i]) { offsets[output_array_index] = i; }
+        }
+        if (offsets[output_array_index] == -1) {
+          NIMBLE_ABORT(
+              "\n**** Error in ModelData::GetElementDataForOutput(), output "
+              "label not found.\n");
+        }
+      }
+    }
+
+    std::vector<StateScalar> const& element_data = element_data_np1_.at(block_id);
     for (unsigned int output_array_index = 0; output_array_index < num_output_variables; output_array_index++) {
-      std::string          output_label = output_element_component_labels_for_this_block[output_array_index];
+      int                  offset       = offsets[output_array_index];
       std::vector<double>& output_array = single_component_arrays[block_id][output_array_index];
       if (output_array.size() != array_size) { output_array.resize(array_size); }
-      // determine the offset into the element data array
-      int offset = -1;
-      for (unsigned int i = 0; i < element_component_labels_[block_id].size(); i++) {
-        if (output_label == element_component_labels_[block_id][i]) { offset = i; }
-      }
-      if (offset == -1) {
-        NIMBLE_ABORT(
-            "\n**** Error in ModelData::GetElementDataForOutput(), output "
-            "label not found.\n");
-      }
-      for (int i = 0; i < array_size; i++) {
-        output_array[i] = element_data_np1_[block_id][i * num_element_variables + offset];
-      }
+      for (int i = 0; i < array_size; i++) { output_array[i] = element_data[i * num_element_variables + offset]; }
     }
   }
 }
@@ -428,7 +439,11 @@ ModelData::EmplaceBlocks(
   for (int block_id : block_ids) {
     std::string const& model_material_parameters = parser_.GetModelMaterialParameters(block_id);
     auto               block_ptr                 = std::shared_ptr<nimble::Block>(new TBlock());
-    block_ptr->Initialize(model_material_parameters, *material_factory_ptr);
+    block_ptr->Initialize(
+        model_material_parameters,
+        mesh_.GetElementType(block_id),
+        parser_.GetElementFormulation(block_id),
+        *material_factory_ptr);
     std::vector<std::pair<std::string, nimble::Length>> data_labels_and_lengths;
     block_ptr->GetDataLabelsAndLengths(data_labels_and_lengths);
     DeclareElementData(block_id, data_labels_and_lengths);
@@ -466,12 +481,12 @@ ModelData::AllocateInitializeElementData(
 
   // Initialize the element data
   for (auto& block_it : blocks_) {
-    int                     block_id          = block_it.first;
-    int                     num_elem_in_block = mesh_.GetNumElementsInBlock(block_id);
-    std::vector<int> const& elem_global_ids   = mesh_.GetElementGlobalIdsInBlock(block_id);
-    auto&                   block             = block_it.second;
-    std::vector<double>&    elem_data_n       = GetElementDataOld(block_id);
-    std::vector<double>&    elem_data_np1     = GetElementDataNew(block_id);
+    int                       block_id          = block_it.first;
+    int                       num_elem_in_block = mesh_.GetNumElementsInBlock(block_id);
+    std::vector<int> const&   elem_global_ids   = mesh_.GetElementGlobalIdsInBlock(block_id);
+    auto&                     block             = block_it.second;
+    std::vector<StateScalar>& elem_data_n       = GetElementDataOld(block_id);
+    std::vector<StateScalar>& elem_data_np1     = GetElementDataNew(block_id);
     block->InitializeElementData(
         num_elem_in_block,
         elem_global_ids,
@@ -565,8 +580,11 @@ ModelData::WriteExodusOutput(nimble::DataManager& data_manager, double time_curr
   auto reference_coord_ = GetNodeData("reference_coordinate");
   auto displacement     = GetNodeData("displacement");
 
+  // Derived data (element volume and volume averages) are only evaluated for
+  // blocks that actually request them, in a single pass over the block
   for (auto& block_it : blocks_) {
-    int         block_id          = block_it.first;
+    int block_id = block_it.first;
+    if (derived_output_element_data_labels_.at(block_id).empty()) { continue; }
     auto        block             = block_it.second;
     int         num_elem_in_block = mesh_.GetNumElementsInBlock(block_id);
     int const*  elem_conn         = mesh_.GetConnectivity(block_id);
@@ -633,37 +651,176 @@ ModelData::ComputeInternalForce(
   auto reference_coord = GetNodeData("reference_coordinate");
   auto velocity        = GetNodeData("velocity");
 
+  // Element sleeping is only meaningful for the explicit scheme, where the
+  // internal force is evaluated once per time step
+  const auto& parser = data_manager.GetParser();
+  const bool  use_element_sleeping =
+      (parser.ElementSleepingVelocityThreshold() > 0.0) && (parser.TimeIntegrationScheme() == "explicit");
+  if (use_element_sleeping) UpdateElementActivity(data_manager, velocity);
+
+  // The decision comes from the parser so that every rank joins the reductions
+  const bool use_nodal_averaging = parser.HasElementFormulation("nodal_averaged");
+  if (use_nodal_averaging) UpdateNodalJacobian(data_manager, reference_coord, displacement.data());
+
+  auto          vector_comm      = data_manager.GetVectorCommunicator();
+  constexpr int vector_dimension = 3;
+
+  // With several ranks, the elements touching shared nodes, tiled apart from the
+  // others, can be processed first; the reduction of the shared nodes then
+  // overlaps the interior tiles
+  const bool overlap_reduction = parser.OverlapInternalForceReduction() && (parser.GetNumRanks() > 1);
+  if (overlap_reduction && node_is_shared_.empty()) {
+    node_is_shared_.assign(mesh.GetNumNodes(), 0);
+    globally_shared_nodes_.clear();
+    vector_comm->GetSharedNodeLocalIds(globally_shared_nodes_);
+    for (int node : globally_shared_nodes_) node_is_shared_[node] = 1;
+  }
+
+  auto compute_block_forces = [&](nimble::TileSubset tile_subset) {
+    for (auto& block_it : blocks_) {
+      int                             block_id          = block_it.first;
+      int                             num_elem_in_block = mesh.GetNumElementsInBlock(block_id);
+      int const*                      elem_conn         = mesh.GetConnectivity(block_id);
+      std::vector<int> const&         elem_global_ids   = mesh.GetElementGlobalIdsInBlock(block_id);
+      auto&                           block             = block_it.second;
+      std::vector<StateScalar> const& elem_data_n       = GetElementDataOld(block_id);
+      std::vector<StateScalar>&       elem_data_np1     = GetElementDataNew(block_id);
+      nimble::ElementActivity*        activity          = use_element_sleeping ? &element_activity_[block_id] : nullptr;
+      block->ComputeInternalForce(
+          reference_coord,
+          displacement.data(),
+          velocity,
+          force.data(),
+          time_previous,
+          time_current,
+          num_elem_in_block,
+          elem_conn,
+          elem_global_ids.data(),
+          element_component_labels_.at(block_id),
+          elem_data_n,
+          elem_data_np1,
+          data_manager,
+          is_output_step,
+          false,
+          activity,
+          tile_subset,
+          &node_is_shared_,
+          block->UsesNodalAveraging() ? nodal_jacobian_.data() : nullptr);
+      if (tile_subset == nimble::INTERIOR_TILES) vector_comm->ProgressVectorReduction(vector_dimension, force.data());
+    }
+  };
+
+  if (!overlap_reduction) {
+    compute_block_forces(nimble::ALL_TILES);
+
+    // DJL
+    // Perform a vector reduction on internal force.  This is a vector nodal
+    // quantity.
+    vector_comm->VectorReduction(vector_dimension, force.data());
+    return;
+  }
+
+  compute_block_forces(nimble::BOUNDARY_TILES);
+  vector_comm->StartVectorReduction(vector_dimension, force.data());
+  compute_block_forces(nimble::INTERIOR_TILES);
+  vector_comm->FinishVectorReduction(vector_dimension, force.data());
+}
+
+void
+ModelData::UpdateNodalJacobian(
+    nimble::DataManager& data_manager,
+    const double*        reference_coordinates,
+    const double*        displacement)
+{
+  const auto&   mesh             = data_manager.GetMesh();
+  const int     num_nodes        = static_cast<int>(mesh.GetNumNodes());
+  auto          vector_comm      = data_manager.GetVectorCommunicator();
+  constexpr int scalar_dimension = 1;
+
+  auto accumulate_nodal_volume = [&](const double* disp, std::vector<double>& nodal_volume) {
+    nodal_volume.assign(num_nodes, 0.0);
+    for (auto& block_it : blocks_) {
+      int   block_id = block_it.first;
+      auto& block    = block_it.second;
+      if (!block->UsesNodalAveraging()) continue;
+      block->ComputeNodalVolume(
+          reference_coordinates,
+          disp,
+          mesh.GetNumElementsInBlock(block_id),
+          mesh.GetConnectivity(block_id),
+          nodal_volume.data());
+    }
+    vector_comm->VectorReduction(scalar_dimension, nodal_volume.data());
+  };
+
+  // The reference volume only needs to be computed once
+  if (nodal_reference_volume_.size() != static_cast<std::size_t>(num_nodes)) {
+    accumulate_nodal_volume(nullptr, nodal_reference_volume_);
+  }
+
+  accumulate_nodal_volume(displacement, nodal_jacobian_);
+  for (int n = 0; n < num_nodes; n++) {
+    nodal_jacobian_[n] = (nodal_reference_volume_[n] > 0.0) ? nodal_jacobian_[n] / nodal_reference_volume_[n] : 1.0;
+  }
+}
+
+void
+ModelData::UpdateElementActivity(nimble::DataManager& data_manager, const double* velocity)
+{
+  const auto&  mesh               = data_manager.GetMesh();
+  const auto&  parser             = data_manager.GetParser();
+  const double velocity_threshold = parser.ElementSleepingVelocityThreshold();
+  const double strain_threshold   = parser.ElementSleepingStrainThreshold();
+  const int    num_nodes          = static_cast<int>(mesh.GetNumNodes());
+
+  // Nodal activity flags, stored as doubles for the vector reduction
+  std::vector<double> node_is_active(num_nodes, 0.0);
+  for (int n = 0; n < num_nodes; n++) {
+    for (int i = 0; i < dim_; i++) {
+      if (std::abs(velocity[dim_ * n + i]) > velocity_threshold) { node_is_active[n] = 1.0; }
+    }
+  }
+
   for (auto& block_it : blocks_) {
-    int                        block_id          = block_it.first;
-    int                        num_elem_in_block = mesh.GetNumElementsInBlock(block_id);
-    int const*                 elem_conn         = mesh.GetConnectivity(block_id);
-    std::vector<int> const&    elem_global_ids   = mesh.GetElementGlobalIdsInBlock(block_id);
-    auto&                      block             = block_it.second;
-    std::vector<double> const& elem_data_n       = GetElementDataOld(block_id);
-    std::vector<double>&       elem_data_np1     = GetElementDataNew(block_id);
-    block->ComputeInternalForce(
-        reference_coord,
-        displacement.data(),
-        velocity,
-        force.data(),
-        time_previous,
-        time_current,
-        num_elem_in_block,
-        elem_conn,
-        elem_global_ids.data(),
-        element_component_labels_.at(block_id),
-        elem_data_n,
-        elem_data_np1,
-        data_manager,
-        is_output_step);
+    int        block_id           = block_it.first;
+    int        num_elem_in_block  = mesh.GetNumElementsInBlock(block_id);
+    int        num_nodes_per_elem = mesh.GetNumNodesPerElement(block_id);
+    int const* elem_conn          = mesh.GetConnectivity(block_id);
+    auto&      activity           = element_activity_[block_id];
+    if (activity.is_awake.size() != static_cast<std::size_t>(num_elem_in_block)) {
+      // Every element is awake and deforming until its first update
+      activity.is_awake.assign(num_elem_in_block, 1);
+      activity.strain_increment.assign(num_elem_in_block, std::numeric_limits<double>::max());
+      activity.nodal_force.assign(num_elem_in_block * num_nodes_per_elem * dim_, 0.0);
+    }
+    for (int elem = 0; elem < num_elem_in_block; elem++) {
+      if (activity.is_awake[elem] && activity.strain_increment[elem] > strain_threshold) {
+        for (int node = 0; node < num_nodes_per_elem; node++) {
+          node_is_active[elem_conn[elem * num_nodes_per_elem + node]] = 1.0;
+        }
+      }
+    }
   }
 
-  // DJL
-  // Perform a vector reduction on internal force.  This is a vector nodal
-  // quantity.
+  // A deforming element wakes up its neighbors on the other ranks
   auto          vector_comm      = data_manager.GetVectorCommunicator();
-  constexpr int vector_dimension = 3;
-  vector_comm->VectorReduction(vector_dimension, force.data());
+  constexpr int scalar_dimension = 1;
+  vector_comm->VectorReduction(scalar_dimension, node_is_active.data());
+
+  for (auto& block_it : blocks_) {
+    int        block_id           = block_it.first;
+    int        num_elem_in_block  = mesh.GetNumElementsInBlock(block_id);
+    int        num_nodes_per_elem = mesh.GetNumNodesPerElement(block_id);
+    int const* elem_conn          = mesh.GetConnectivity(block_id);
+    auto&      activity           = element_activity_[block_id];
+    for (int elem = 0; elem < num_elem_in_block; elem++) {
+      char is_awake = 0;
+      for (int node = 0; node < num_nodes_per_elem; node++) {
+        if (node_is_active[elem_conn[elem * num_nodes_per_elem + node]] > 0.0) { is_awake = 1; }
+      }
+      activity.is_awake[elem] = is_awake;
+    }
+  }
 }
 
 }  // namespace nimble
@@ -191,13 +191,13 @@ class ModelData : public ModelDataBase
   void
   AllocateElementData(std::map<int, int> const& num_integration_points_in_each_block);
 
-  std::vector<double>&
+  std::vector<StateScalar>&
   GetElementDataOld(int block_id)
   {
     return element_data_n_.at(block_id);
   }
 
-  std::vector<double>&
+  std::vector<StateScalar>&
   GetElementDataNew(int block_id)
   {
     return element_data_np1_.at(block_id);
@@ -254,6 +254,35 @@ class ModelData : public ModelDataBase
       nimble::DataManager&                                data_manager,
       const std::shared_ptr<nimble::MaterialFactoryBase>& material_factory_base);
 
+  /// \brief Determine which elements are asleep for the next internal force evaluation
+  ///
+  /// \param data_manager Reference to the data manager
+  /// \param velocity Nodal velocities
+  ///
+  /// \note A node is active when one of its velocity components exceeds the
+  /// velocity threshold, or when it belongs to an element whose deformation
+  /// gradient increment exceeded the strain threshold at its last update.
+  /// An element sleeps when none of its nodes is active.
+  void
+  UpdateElementActivity(nimble::DataManager& data_manager, const double* velocity);
+
+  /// \brief Compute the volume ratio at the nodes of the blocks with nodal averaging
+  ///
+  /// \param data_manager Reference to the data manager
+  /// \param reference_coordinates Nodal reference coordinates
+  /// \param displacement Nodal displacements
+  ///
+  /// \note The nodal volume ratio is the current volume over the reference volume
+  /// of the elements around the node, each element contributing an equal share
+  /// of its volume to its nodes (Bonet and Burton, 1998).  The deformation
+  /// gradient of each element is then scaled to the average ratio of its nodes,
+  /// which removes the volumetric locking of the 4-node tetrahedron.
+  void
+  UpdateNodalJacobian(
+      nimble::DataManager& data_manager,
+      const double*        reference_coordinates,
+      const double*        displacement);
+
  protected:
   //! Block ids
   std::vector<int> block_ids_;
@@ -274,15 +303,18 @@ class ModelData : public ModelDataBase
 
   //! Map key is the block_id, vector contains full data array for that block at
   //! step N.
-  std::map<int, std::vector<double>> element_data_n_;
+  std::map<int, std::vector<StateScalar>> element_data_n_;
 
   //! Map key is the block_id, vector contains full data array for that block at
   //! step N+1.
-  std::map<int, std::vector<double>> element_data_np1_;
+  std::map<int, std::vector<StateScalar>> element_data_np1_;
 
   //! List of node ids that are shared across multiple ranks
   std::vector<int> globally_shared_nodes_;
 
+  //! Flag for each node, nonzero when the node is shared across multiple ranks
+  std::vector<char> node_is_shared_;
+
   //! Map from global node it to local node id
   std::map<int, int> global_node_id_to_local_node_id_;
 
@@ -292,8 +324,21 @@ class ModelData : public ModelDataBase
   //! Information for Exodus output about element data
   std::map<int, std::vector<std::vector<double>>> elem_data_for_output_;
 
+  //! Map key is the block_id, value is the offset of each output element
+  //! component label into the element data array (built on first output)
+  std::map<int, std::vector<int>> output_element_component_offsets_;
+
   //! Information for Exodus output about element data
   std::map<int, std::vector<std::vector<double>>> derived_elem_data_;
+
+  //! Map key is the block_id, value is the activity data for element sleeping
+  std::map<int, nimble::ElementActivity> element_activity_;
+
+  //! Reference volume attributed to each node by the blocks with nodal averaging
+  std::vector<double> nodal_reference_volume_;
+
+  //! Current over reference nodal volume, for the blocks with nodal averaging
+  std::vector<double> nodal_jacobian_;
 };
 
 }  // namespace nimble
@@ -156,11 +156,30 @@ IOFileNameThreadSafe(
   }
 }
 
-BlockProperties::BlockProperties(std::string props) : block_id_(-1)
+BlockProperties::BlockProperties(std::string props) : block_id_(-1), element_formulation_("standard")
 {
-  size_t space_pos                 = props.find(" ");
-  block_name_                      = props.substr(0, space_pos);
-  material_key_                    = props.substr(space_pos + 1, props.size());
+  std::stringstream        props_ss(props);
+  std::vector<std::string> vals;
+  std::string              val;
+  while (props_ss >> val) { vals.push_back(val); }
+
+  if ((vals.size() != 2 && vals.size() != 4) || (vals.size() == 4 && vals[2] != "formulation")) {
+    std::string msg = "\n**** Error in BlockProperties(), unexpected value for \"element block\"\n";
+    msg += "**** Allowable syntax is \"<block_name> <material_key> [formulation <formulation>]\"\n";
+    throw std::invalid_argument(msg);
+  }
+  block_name_   = vals[0];
+  material_key_ = vals[1];
+  if (vals.size() == 4) {
+    element_formulation_ = vals[3];
+    if (element_formulation_ != "standard" && element_formulation_ != "composite" &&
+        element_formulation_ != "nodal_averaged") {
+      std::string msg = "\n**** Error in BlockProperties(), unknown element formulation " + element_formulation_ + "\n";
+      msg += "**** Allowable values are \"standard\", \"composite\" and \"nodal_averaged\"\n";
+      throw std::invalid_argument(msg);
+    }
+  }
+
   size_t            underscore_pos = block_name_.rfind("_");
   std::string       block_id_str   = block_name_.substr(underscore_pos + 1, block_name_.size());
   std::stringstream ss;
@@ -170,12 +189,20 @@ BlockProperties::BlockProperties(std::string props) : block_id_(-1)
 
 Parser::Parser()
     : genesis_file_name_("none"),
+      exodus_file_name_("none"),
       use_two_level_mesh_decomposition_(false),
       write_timing_data_file_(false),
-      exodus_file_name_("none"),
-      time_integration_scheme_("explicit"),
+      overlap_internal_force_reduction_(false),
       nonlinear_solver_relative_tolerance_(1.0e-6),
       nonlinear_solver_max_iterations_(200),
+      nonlinear_solver_("full newton"),
+      tangent_refresh_interval_(10),
+      tangent_refresh_ratio_(0.5),
+      time_integration_scheme_("explicit"),
+      dynamic_relaxation_damping_("rayleigh quotient"),
+      dynamic_relaxation_max_iterations_(10000),
+      hht_alpha_(0.0),
+      mass_proportional_damping_(0.0),
       initial_time_(0.0),
       final_time_(0.0),
       num_load_steps_(0),
@@ -272,12 +299,45 @@ Parser::ParseKeyValue(const std::string& key, const std::string& value)
           value + "\n";
       throw std::invalid_argument(msg);
     }
+  } else if (key == "overlap internal force reduction") {
+    std::string value_upper_case(value);
+    std::transform(
+        value_upper_case.begin(), value_upper_case.end(), value_upper_case.begin(), (int (*)(int))std::toupper);
+    if (value_upper_case == "TRUE" || value_upper_case == "YES" || value_upper_case == "ON") {
+      overlap_internal_force_reduction_ = true;
+    } else if (value_upper_case == "FALSE" || value_upper_case == "NO" || value_upper_case == "OFF") {
+      overlap_internal_force_reduction_ = false;
+    } else {
+      std::string msg =
+          "\n**** Error in Parser::ReadFile(), unexpected value for \"overlap "
+          "internal force reduction\" " +
+          value + "\n";
+      throw std::invalid_argument(msg);
+    }
   } else if (key == "time integration scheme") {
     time_integration_scheme_ = value;
   } else if (key == "nonlinear solver relative tolerance") {
     nonlinear_solver_relative_tolerance_ = std::atof(value.c_str());
   } else if (key == "nonlinear solver maximum iterations") {
     nonlinear_solver_max_iterations_ = std::atoi(value.c_str());
+  } else if (key == "nonlinear solver") {
+    nonlinear_solver_ = value;
+  } else if (key == "tangent refresh interval") {
+    tangent_refresh_interval_ = std::atoi(value.c_str());
+  } else if (key == "tangent refresh ratio") {
+    tangent_refresh_ratio_ = std::atof(value.c_str());
+  } else if (key == "dynamic relaxation damping") {
+    dynamic_relaxation_damping_ = value;
+  } else if (key == "dynamic relaxation maximum iterations") {
+    dynamic_relaxation_max_iterations_ = std::atoi(value.c_str());
+  } else if (key == "hht alpha") {
+    hht_alpha_ = std::atof(value.c_str());
+    if (hht_alpha_ < -1.0 / 3.0 || hht_alpha_ > 0.0) {
+      std::string msg = "\n**** Error in Parser::ReadFile(), \"hht alpha\" must be in [-1/3, 0], got " + value + "\n";
+      throw std::invalid_argument(msg);
+    }
+  } else if (key == "mass proportional damping") {
+    mass_proportional_damping_ = std::atof(value.c_str());
   } else if (key == "initial time") {
     initial_time_ = std::atof(value.c_str());
   } else if (key == "final time") {
@@ -286,8 +346,12 @@ Parser::ParseKeyValue(const std::string& key, const std::string& value)
     num_load_steps_ = std::atoi(value.c_str());
   } else if (key == "output frequency") {
     output_frequency_ = std::atoi(value.c_str());
+  } else if (key == "element sleeping velocity threshold") {
+    element_sleeping_velocity_threshold_ = std::atof(value.c_str());
+  } else if (key == "element sleeping strain threshold") {
+    element_sleeping_strain_threshold_ = std::atof(value.c_str());
   } else if (key == "contact") {
-    contact_string_ = value;
+    contact_strings_.push_back(value);
   } else if (key == "contact backend") {
     contact_backend_string_ = value;
   } else if (key == "contact visualization") {
@@ -84,9 +84,13 @@ IOFileNameThreadSafe(
     int               num_threads,
     char* const       file_name);
 
+/// \brief Block name, material and element formulation from an "element block" line
+///
+/// The syntax is "<block_name> <material_key> [formulation <standard/composite/nodal_averaged>]".
+/// The composite formulation applies to 10-node tetrahedra, nodal averaging to 4-node tetrahedra.
 struct BlockProperties
 {
-  BlockProperties() : block_name_("none"), block_id_(-1) {}
+  BlockProperties() : block_name_("none"), block_id_(-1), element_formulation_("standard") {}
   BlockProperties(std::string props);
 
 #ifdef NIMBLE_HAVE_DARMA
@@ -94,13 +98,14 @@ struct BlockProperties
   void
   serialize(ArchiveType& ar)
   {
-    ar | block_name_ | block_id_ | material_key_;
+    ar | block_name_ | block_id_ | material_key_ | element_formulation_;
   }
 #endif
 
   std::string block_name_;
   int         block_id_;
   std::string material_key_;
+  std::string element_formulation_;
 };
 
 class Parser
@@ -117,10 +122,14 @@ class Parser
   {
     ar | file_name_ | genesis_file_name_;
     ar | exodus_file_name_ | use_two_level_mesh_decomposition_;
-    ar | write_timing_data_file_ | time_integration_scheme_;
+    ar | write_timing_data_file_ | overlap_internal_force_reduction_ | time_integration_scheme_;
     ar | nonlinear_solver_relative_tolerance_ | nonlinear_solver_max_iterations_;
+    ar | nonlinear_solver_ | tangent_refresh_interval_ | tangent_refresh_ratio_;
+    ar | dynamic_relaxation_damping_ | dynamic_relaxation_max_iterations_;
+    ar | hht_alpha_ | mass_proportional_damping_;
     ar | initial_time_ | final_time_ | num_load_steps_ | output_frequency_ | reduction_version_;
-    ar | contact_string_ | visualize_contact_entities_ | visualize_contact_bounding_boxes_;
+    ar | element_sleeping_velocity_threshold_ | element_sleeping_strain_threshold_;
+    ar | contact_strings_ | visualize_contact_entities_ | visualize_contact_bounding_boxes_;
     ar | contact_visualization_file_name_ | material_strings_;
     ar | model_blocks_;
     ar | boundary_condition_strings_ | output_field_string_;
@@ -157,10 +166,18 @@ class Parser
     return write_timing_data_file_;
   }
 
+  /// \brief Indicate whether the internal force reduction overlaps the interior elements
+  bool
+  OverlapInternalForceReduction() const
+  {
+    return overlap_internal_force_reduction_;
+  }
+
   std::string
   TimeIntegrationScheme() const
   {
-    if (time_integration_scheme_ != "explicit" && time_integration_scheme_ != "quasistatic") {
+    if (time_integration_scheme_ != "explicit" && time_integration_scheme_ != "quasistatic" &&
+        time_integration_scheme_ != "dynamic relaxation" && time_integration_scheme_ != "implicit dynamics") {
       std::string msg =
           "\n**** Error in Parser::TimeIntegrationScheme(), invalid "
           "integration scheme " +
@@ -182,6 +199,77 @@ class Parser
     return nonlinear_solver_max_iterations_;
   }
 
+  /// \brief Return the strategy for the quasistatic nonlinear solver
+  ///
+  /// \return "full newton", "modified newton", or "bfgs"
+  std::string
+  NonlinearSolver() const
+  {
+    if (nonlinear_solver_ != "full newton" && nonlinear_solver_ != "modified newton" && nonlinear_solver_ != "bfgs") {
+      std::string msg =
+          "\n**** Error in Parser::NonlinearSolver(), invalid "
+          "nonlinear solver " +
+          nonlinear_solver_ + ".\n";
+      throw std::invalid_argument(msg);
+    }
+    return nonlinear_solver_;
+  }
+
+  /// \brief Return the maximum number of iterations between two tangent assemblies
+  int
+  TangentRefreshInterval() const
+  {
+    return tangent_refresh_interval_;
+  }
+
+  /// \brief Return the residual ratio above which the tangent is reassembled
+  ///
+  /// The tangent is reassembled when the residual of an iteration is larger
+  /// than this ratio times the residual of the previous iteration.
+  double
+  TangentRefreshRatio() const
+  {
+    return tangent_refresh_ratio_;
+  }
+
+  /// \brief Return the damping strategy for dynamic relaxation
+  ///
+  /// \return "kinetic energy" or "rayleigh quotient"
+  std::string
+  DynamicRelaxationDamping() const
+  {
+    if (dynamic_relaxation_damping_ != "kinetic energy" && dynamic_relaxation_damping_ != "rayleigh quotient") {
+      std::string msg =
+          "\n**** Error in Parser::DynamicRelaxationDamping(), invalid "
+          "damping " +
+          dynamic_relaxation_damping_ + ".\n";
+      throw std::invalid_argument(msg);
+    }
+    return dynamic_relaxation_damping_;
+  }
+
+  int
+  DynamicRelaxationMaxIterations() const
+  {
+    return dynamic_relaxation_max_iterations_;
+  }
+
+  /// \brief Return the HHT-alpha parameter for implicit dynamics
+  ///
+  /// \return Value in [-1/3, 0], zero gives the Newmark trapezoidal rule
+  double
+  HHTAlpha() const
+  {
+    return hht_alpha_;
+  }
+
+  /// \brief Return the coefficient of the mass-proportional damping C = c M
+  double
+  MassProportionalDamping() const
+  {
+    return mass_proportional_damping_;
+  }
+
   double
   InitialTime() const
   {
@@ -206,10 +294,26 @@ class Parser
     return output_frequency_;
   }
 
+  /// \brief Return the nodal velocity below which a node is at rest for element sleeping
+  ///
+  /// \note Element sleeping is disabled when this threshold is zero.
+  double
+  ElementSleepingVelocityThreshold() const
+  {
+    return element_sleeping_velocity_threshold_;
+  }
+
+  /// \brief Return the deformation gradient increment below which an element may sleep
+  double
+  ElementSleepingStrainThreshold() const
+  {
+    return element_sleeping_strain_threshold_;
+  }
+
   bool
   HasContact() const
   {
-    return (!contact_string_.empty());
+    return (!contact_strings_.empty());
   }
 
   bool
@@ -225,10 +329,18 @@ class Parser
     return contact_visualization_file_name_;
   }
 
+  /// \brief Return the first contact command in the input deck
   std::string
   ContactString() const
   {
-    return contact_string_;
+    return contact_strings_.empty() ? std::string() : contact_strings_.front();
+  }
+
+  /// \brief Return every contact command, one per independent contact interaction
+  const std::vector<std::string>&
+  ContactStrings() const
+  {
+    return contact_strings_;
   }
 
   std::string
@@ -244,6 +356,25 @@ class Parser
     return material_props;
   }
 
+  /// \brief Element formulation of a block, "standard" unless given on its element block line
+  std::string
+  GetElementFormulation(int block_id) const
+  {
+    auto it = model_blocks_.find(block_id);
+    if (it == model_blocks_.end()) { return "standard"; }
+    return it->second.element_formulation_;
+  }
+
+  /// \brief Return true when at least one block uses the given element formulation
+  bool
+  HasElementFormulation(const std::string& element_formulation) const
+  {
+    for (auto const& entry : model_blocks_) {
+      if (entry.second.element_formulation_ == element_formulation) { return true; }
+    }
+    return false;
+  }
+
   int
   GetBlockIdFromMaterial(const std::string& material_key) const
   {
@@ -312,6 +443,14 @@ class Parser
     use_uq_ = true;
   }
 
+  /// \brief Set whether the contact force is computed concurrently with the internal force
+  ///
+  void
+  SetToOverlapContact(bool overlap)
+  {
+    overlap_contact_ = overlap;
+  }
+
   /// \brief Set that VT is used for the simulation
   ///
   /// \note The function will abort when an environment
@@ -344,6 +483,13 @@ class Parser
     return use_uq_;
   }
 
+  /// \brief Indicate whether the contact force is computed concurrently with the internal force
+  bool
+  OverlapContact() const
+  {
+    return overlap_contact_;
+  }
+
   /// \brief Indicate whether VT is used
   bool
   UseVT() const
@@ -397,13 +543,11 @@ class Parser
   }
 #endif
 
-#ifdef NIMBLE_HAVE_BVH
   int
   ContactDicing() const noexcept
   {
     return contact_dicing_;
   }
-#endif
 
 #ifdef NIMBLE_HAVE_UQ
   std::string const&
@@ -438,14 +582,24 @@ class Parser
   std::string                        exodus_file_name_;
   bool                               use_two_level_mesh_decomposition_;
   bool                               write_timing_data_file_;
+  bool                               overlap_internal_force_reduction_;
   double                             nonlinear_solver_relative_tolerance_;
   int                                nonlinear_solver_max_iterations_;
+  std::string                        nonlinear_solver_;
+  int                                tangent_refresh_interval_;
+  double                             tangent_refresh_ratio_;
   std::string                        time_integration_scheme_;
+  std::string                        dynamic_relaxation_damping_;
+  int                                dynamic_relaxation_max_iterations_;
+  double                             hht_alpha_;
+  double                             mass_proportional_damping_;
   double                             initial_time_{0.0};
   double                             final_time_{0.0};
   int                                num_load_steps_;
   int                                output_frequency_;
-  std::string                        contact_string_;
+  double                             element_sleeping_velocity_threshold_{0.0};
+  double                             element_sleeping_strain_threshold_{0.0};
+  std::vector<std::string>           contact_strings_;
   std::string                        contact_backend_string_;
   bool                               visualize_contact_entities_;
   bool                               visualize_contact_bounding_boxes_;
@@ -455,9 +609,7 @@ class Parser
   std::vector<std::string>           boundary_condition_strings_;
   std::string                        output_field_string_;
 
-#ifdef NIMBLE_HAVE_BVH
   int contact_dicing_ = 1;
-#endif
 
 #ifdef NIMBLE_HAVE_UQ
   std::map<std::string, std::string> uq_parameters_strings_;
@@ -484,6 +636,9 @@ class Parser
   /// \brief Boolean setting the usage of UQ
   bool use_uq_ = false;
 
+  /// \brief Boolean setting the concurrent evaluation of contact and internal forces
+  bool overlap_contact_ = false;
+
   /// \brief Rank ID when running with MPI
   int my_rank_ = 0;
 
@@ -73,10 +73,32 @@ TpetraContainer::Initialize(int d, unsigned int n, comm_type comm, std::vector<i
 
   SimpleTieBreak<local_ordinal_type, global_ordinal_type> tie_break;
 
-  // tpetra vector for scalar data (e.g., lumped mass)
-  local_ordinal_type               num_1d_entries = num_nodes;
+  // identify the nodes that also live on other ranks by counting the copies of
+  // each node; the reductions only exchange these shared nodes
+  {
+    std::vector<global_ordinal_type> my_entries(num_nodes);
+    for (int i_node = 0; i_node < num_nodes; i_node++) { my_entries[i_node] = global_node_ids_[i_node]; }
+    Teuchos::RCP<const map_type> map =
+        Teuchos::rcp(new map_type(num_global_elements, my_entries.data(), num_nodes, index_base, comm_));
+    Teuchos::RCP<const map_type> map_one_to_one = Tpetra::createOneToOne(map, tie_break);
+    vector_type                  node_count(map);
+    vector_type                  node_count_one_to_one(map_one_to_one);
+    node_count.putScalar(1.0);
+    node_count_one_to_one.doExport(node_count, export_type(map, map_one_to_one), Tpetra::CombineMode::ADD);
+    node_count.doImport(node_count_one_to_one, import_type(map_one_to_one, map), Tpetra::CombineMode::INSERT);
+
+    Teuchos::ArrayRCP<const scalar_type> count = node_count.getData();
+    shared_node_local_ids_.clear();
+    for (int i_node = 0; i_node < num_nodes; i_node++) {
+      if (count[i_node] > 1.5) { shared_node_local_ids_.push_back(i_node); }
+    }
+  }
+  const auto num_shared_nodes = static_cast<local_ordinal_type>(shared_node_local_ids_.size());
+
+  // tpetra vector for scalar data (e.g., lumped mass) at the shared nodes
+  local_ordinal_type               num_1d_entries = num_shared_nodes;
   std::vector<global_ordinal_type> my_1d_entries(num_1d_entries);
-  for (int i_node = 0; i_node < num_nodes; i_node++) { my_1d_entries[i_node] = global_node_ids_[i_node]; }
+  for (int i = 0; i < num_shared_nodes; i++) { my_1d_entries[i] = global_node_ids_[shared_node_local_ids_[i]]; }
   Teuchos::RCP<const map_type> map_1d =
       Teuchos::rcp(new map_type(num_global_elements, my_1d_entries.data(), num_1d_entries, index_base, comm_));
   vec_1d_ = Teuchos::rcp(new vector_type(map_1d));
@@ -87,11 +109,12 @@ TpetraContainer::Initialize(int d, unsigned int n, comm_type comm, std::vector<i
   export_into_vec_1d_one_to_one_ = Teuchos::rcp(new export_type(map_1d, map_1d_one_to_one));
   import_from_vec_1d_one_to_one_ = Teuchos::rcp(new import_type(map_1d_one_to_one, map_1d));
 
-  // tpetra vector for vector data (e.g., internal force)
-  local_ordinal_type               num_3d_entries = num_nodes * dim_;
+  // tpetra vector for vector data (e.g., internal force) at the shared nodes
+  local_ordinal_type               num_3d_entries = num_shared_nodes * dim_;
   std::vector<global_ordinal_type> my_3d_entries(num_3d_entries);
-  for (int i_node = 0; i_node < num_nodes; i_node++) {
-    for (int dof = 0; dof < dim_; dof++) { my_3d_entries[i_node * dim_ + dof] = global_node_ids_[i_node] * dim_ + dof; }
+  for (int i = 0; i < num_shared_nodes; i++) {
+    global_ordinal_type global_id = global_node_ids_[shared_node_local_ids_[i]];
+    for (int dof = 0; dof < dim_; dof++) { my_3d_entries[i * dim_ + dof] = global_id * dim_ + dof; }
   }
   Teuchos::RCP<const map_type> map_3d =
       Teuchos::rcp(new map_type(num_global_elements, my_3d_entries.data(), num_3d_entries, index_base, comm_));
@@ -248,32 +271,37 @@ TpetraContainer::VectorReduction(int data_dimension, double* data)
   Length length = SCALAR;
   if (data_dimension == dim_) length = VECTOR;
 
+  // only the shared nodes are exchanged, the other entries are already complete
+  const auto num_shared_nodes = static_cast<int>(shared_node_local_ids_.size());
+
   if (length == SCALAR) {
-    // load the data into a tpetra vector
+    // gather the shared entries into the tpetra vector
     Teuchos::ArrayRCP<scalar_type> vec_1d_data = vec_1d_->getDataNonConst();
-    for (unsigned int i_node = 0; i_node < global_node_ids_.size(); i_node++) { vec_1d_data[i_node] = data[i_node]; }
+    for (int i = 0; i < num_shared_nodes; i++) { vec_1d_data[i] = data[shared_node_local_ids_[i]]; }
 
     // use tpetra import/export to allreduce over the vector
     vec_1d_one_to_one_->doExport(*vec_1d_, *export_into_vec_1d_one_to_one_, Tpetra::CombineMode::ADD);
     vec_1d_->doImport(*vec_1d_one_to_one_, *import_from_vec_1d_one_to_one_, Tpetra::CombineMode::INSERT);
 
-    // copy the reduced values back into the original container
-    for (unsigned int i_node = 0; i_node < global_node_ids_.size(); i_node++) { data[i_node] = vec_1d_data[i_node]; }
+    // scatter the reduced values back into the original container
+    for (int i = 0; i < num_shared_nodes; i++) { data[shared_node_local_ids_[i]] = vec_1d_data[i]; }
   } else if (length == VECTOR) {
-    // load the data into a tpetra vector
+    // gather the shared entries into the tpetra vector
     Teuchos::ArrayRCP<scalar_type> vec_3d_data = vec_3d_->getDataNonConst();
     int                            num_dof     = LengthToInt(length, dim_);
-    for (unsigned int i_node = 0; i_node < global_node_ids_.size(); i_node++) {
-      for (int dof = 0; dof < num_dof; dof++) { vec_3d_data[i_node * dim_ + dof] = data[i_node * dim_ + dof]; }
+    for (int i = 0; i < num_shared_nodes; i++) {
+      int i_node = shared_node_local_ids_[i];
+      for (int dof = 0; dof < num_dof; dof++) { vec_3d_data[i * dim_ + dof] = data[i_node * dim_ + dof]; }
     }
 
     // use tpetra import/export to allreduce over the vector
     vec_3d_one_to_one_->doExport(*vec_3d_, *export_into_vec_3d_one_to_one_, Tpetra::CombineMode::ADD);
     vec_3d_->doImport(*vec_3d_one_to_one_, *import_from_vec_3d_one_to_one_, Tpetra::CombineMode::INSERT);
 
-    // copy the reduced values back into the original container
-    for (unsigned int i_node = 0; i_node < global_node_ids_.size(); i_node++) {
-      for (int dof = 0; dof < num_dof; dof++) { data[i_node * dim_ + dof] = vec_3d_data[i_node * dim_ + dof]; }
+    // scatter the reduced values back into the original container
+    for (int i = 0; i < num_shared_nodes; i++) {
+      int i_node = shared_node_local_ids_[i];
+      for (int dof = 0; dof < num_dof; dof++) { data[i_node * dim_ + dof] = vec_3d_data[i * dim_ + dof]; }
     }
   }
 
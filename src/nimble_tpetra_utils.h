@@ -185,6 +185,8 @@ class TpetraContainer
 
   int              dim_;
   std::vector<int> global_node_ids_;
+  /// \brief Local ids of the nodes that also live on other ranks
+  std::vector<int> shared_node_local_ids_;
 
 #ifdef NIMBLE_HAVE_TRILINOS
   comm_type                                                                   comm_;
@@ -892,6 +892,15 @@ Polar_Decomp(
   Mult_Full33_Sym33_ReturnT(mat_inv, left_stretch, rotation);
 }
 
+//! Left Cauchy-Green tensor b = F F^T (symmetric storage), returns J = det(F)
+template <typename ScalarT>
+NIMBLE_INLINE_FUNCTION ScalarT
+LeftCauchyGreen_Full33(const ScalarT* const def_grad, ScalarT* const left_cauchy_green)
+{
+  Square_Full33_Full33T(def_grad, left_cauchy_green);
+  return Determinant_Full33(def_grad);
+}
+
 template <typename ScalarT>
 NIMBLE_INLINE_FUNCTION void
 Polar_Left_LogV_Lame(
@@ -156,6 +156,70 @@ class VectorCommunicator
 #endif
   }
 
+  /// \brief Start a reduction whose values at the shared nodes are final
+  ///
+  /// \param data_dimension
+  /// \param data
+  ///
+  /// \note Only the shared nodes are read when starting and written when
+  /// finishing, so the other entries of data may still be updated in between.
+  void
+  StartVectorReduction(int data_dimension, double* data)
+  {
+#ifdef NIMBLE_HAVE_TRILINOS
+    if (TpetraReductionInfo) return;
+#endif
+
+#ifdef NIMBLE_HAVE_MPI
+    MeshReductionInfo->StartReduction(data, data_dimension);
+#endif
+  }
+
+  /// \brief Advance a reduction started with StartVectorReduction
+  ///
+  /// \return True once the reduction has completed
+  bool
+  ProgressVectorReduction(int data_dimension, double* data)
+  {
+#ifdef NIMBLE_HAVE_TRILINOS
+    if (TpetraReductionInfo) return false;
+#endif
+
+#ifdef NIMBLE_HAVE_MPI
+    return MeshReductionInfo->ProgressReduction(data, data_dimension);
+#else
+    return true;
+#endif
+  }
+
+  /// \brief Complete a reduction started with StartVectorReduction
+  void
+  FinishVectorReduction(int data_dimension, double* data)
+  {
+#ifdef NIMBLE_HAVE_TRILINOS
+    if (TpetraReductionInfo) {
+      // the Tpetra path has no split phases
+      TpetraReductionInfo->VectorReduction(data_dimension, data);
+      return;
+    }
+#endif
+
+#ifdef NIMBLE_HAVE_MPI
+    while (!MeshReductionInfo->ProgressReduction(data, data_dimension)) {}
+#endif
+  }
+
+  /// \brief Local ids of the nodes shared with other ranks
+  ///
+  /// \param node_local_ids
+  void
+  GetSharedNodeLocalIds(std::vector<int>& node_local_ids)
+  {
+#ifdef NIMBLE_HAVE_MPI
+    MeshReductionInfo->GetSharedIndices(node_local_ids);
+#endif
+  }
+
   /// \brief
   ///
   /// \tparam Lookup
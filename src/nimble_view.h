@@ -65,6 +65,9 @@ namespace details {
 template <std::size_t N>
 class AXPYResult;
 
+template <class Derived>
+struct ViewExpression;
+
 }
 
 template <std::size_t N = 2, class Scalar = double>
@@ -136,6 +139,13 @@ class Viewify
   Viewify<N, Scalar>&
   operator+=(const details::AXPYResult<N>& rhs);
 
+  /// \brief Evaluate an expression into the data of this view in a single pass
+  ///
+  /// \note Unlike copy assignment, this does not rebind the view.
+  template <class E, class T = Scalar, typename = typename std::enable_if<!std::is_const<T>::value>::type>
+  Viewify<N, Scalar>&
+  operator=(const details::ViewExpression<E>& rhs);
+
   std::array<int, N>
   size() const
   {
@@ -158,11 +168,64 @@ class Viewify
 
 namespace details {
 
+/// \brief Base of the lazily evaluated expressions over the flat storage of Viewify objects
+///
+/// \note Expressions are evaluated entry by entry in a single loop, so
+/// `v = v + dt * a` streams each array once. Like AXPYResult, operands are
+/// assumed to have the same length and stride.
+template <class Derived>
+struct ViewExpression
+{
+  NIMBLE_INLINE_FUNCTION const Derived&
+  self() const
+  {
+    return static_cast<const Derived&>(*this);
+  }
+};
+
+/// \brief Leaf expression reading the data of a Viewify
+template <std::size_t N>
+struct ViewTerm : public ViewExpression<ViewTerm<N>>
+{
+  template <class Scalar>
+  explicit ViewTerm(const nimble::Viewify<N, Scalar>& A)
+      : data_(A.data()), size_(static_cast<long>(A.size()[0]) * A.stride()[0])
+  {
+  }
+
+  NIMBLE_INLINE_FUNCTION double
+  operator[](long ii) const
+  {
+    return data_[ii];
+  }
+
+  long
+  size() const
+  {
+    return size_;
+  }
+
+  const double* data_;
+  const long    size_;
+};
+
 template <std::size_t N>
-struct AXPYResult
+struct AXPYResult : public ViewExpression<AXPYResult<N>>
 {
   AXPYResult(const nimble::Viewify<N> A, double alpha) : A_(A), alpha_(alpha) {}
 
+  NIMBLE_INLINE_FUNCTION double
+  operator[](long ii) const
+  {
+    return alpha_ * A_.data()[ii];
+  }
+
+  long
+  size() const
+  {
+    return static_cast<long>(A_.size()[0]) * A_.stride()[0];
+  }
+
   /// \brief Compute "dest = (destCoef) * dest + rhsCoef * alpha_ * A_"
   ///
   /// \param[in] destCoef Scalar
@@ -200,6 +263,145 @@ AXPYResult<N>::assignTo(double destCoef, double rhsCoef, nimble::Viewify<N>& des
   }
 }
 
+template <class L, class R>
+struct SumExpression : public ViewExpression<SumExpression<L, R>>
+{
+  SumExpression(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+
+  NIMBLE_INLINE_FUNCTION double
+  operator[](long ii) const
+  {
+    return lhs_[ii] + rhs_[ii];
+  }
+
+  long
+  size() const
+  {
+    return lhs_.size();
+  }
+
+  const L lhs_;
+  const R rhs_;
+};
+
+template <class L, class R>
+struct DifferenceExpression : public ViewExpression<DifferenceExpression<L, R>>
+{
+  DifferenceExpression(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+
+  NIMBLE_INLINE_FUNCTION double
+  operator[](long ii) const
+  {
+    return lhs_[ii] - rhs_[ii];
+  }
+
+  long
+  size() const
+  {
+    return lhs_.size();
+  }
+
+  const L lhs_;
+  const R rhs_;
+};
+
+template <class E>
+struct ScaledExpression : public ViewExpression<ScaledExpression<E>>
+{
+  ScaledExpression(double alpha, const E& expr) : alpha_(alpha), expr_(expr) {}
+
+  NIMBLE_INLINE_FUNCTION double
+  operator[](long ii) const
+  {
+    return alpha_ * expr_[ii];
+  }
+
+  long
+  size() const
+  {
+    return expr_.size();
+  }
+
+  const double alpha_;
+  const E      expr_;
+};
+
+/// \brief Map an operand (Viewify or expression) to the expression stored in a parent node
+template <class T, class Enable = void>
+struct ExpressionOperand
+{
+  static constexpr bool value = false;
+};
+
+template <std::size_t N, class Scalar>
+struct ExpressionOperand<nimble::Viewify<N, Scalar>, void>
+{
+  static constexpr bool value = true;
+  using type                  = ViewTerm<N>;
+
+  static type
+  convert(const nimble::Viewify<N, Scalar>& A)
+  {
+    return type(A);
+  }
+};
+
+template <class E>
+struct ExpressionOperand<E, typename std::enable_if<std::is_base_of<ViewExpression<E>, E>::value>::type>
+{
+  static constexpr bool value = true;
+  using type                  = E;
+
+  static const E&
+  convert(const E& expr)
+  {
+    return expr;
+  }
+};
+
+template <class L, class R>
+struct ExpressionOperands
+{
+  static constexpr bool value = ExpressionOperand<L>::value && ExpressionOperand<R>::value;
+};
+
+/// \brief Below this size, the fused loops run on one thread
+constexpr long fused_loop_parallel_threshold = 8192;
+
+template <class E>
+ScaledExpression<E>
+operator*(double alpha, const ViewExpression<E>& expr)
+{
+  return {alpha, expr.self()};
+}
+
+template <class L, class R, typename = typename std::enable_if<ExpressionOperands<L, R>::value>::type>
+SumExpression<typename ExpressionOperand<L>::type, typename ExpressionOperand<R>::type>
+operator+(const L& lhs, const R& rhs)
+{
+  return {ExpressionOperand<L>::convert(lhs), ExpressionOperand<R>::convert(rhs)};
+}
+
+template <class L, class R, typename = typename std::enable_if<ExpressionOperands<L, R>::value>::type>
+DifferenceExpression<typename ExpressionOperand<L>::type, typename ExpressionOperand<R>::type>
+operator-(const L& lhs, const R& rhs)
+{
+  return {ExpressionOperand<L>::convert(lhs), ExpressionOperand<R>::convert(rhs)};
+}
+
+NIMBLE_INLINE_FUNCTION void
+AssignEntry(long ii)
+{
+}
+
+template <std::size_t N, class E, class... Rest>
+NIMBLE_INLINE_FUNCTION void
+AssignEntry(long ii, const nimble::Viewify<N>& dest, const E& expr, const Rest&... rest)
+{
+  dest.data()[ii] = ExpressionOperand<E>::convert(expr)[ii];
+  AssignEntry(ii, rest...);
+}
+
 }  // namespace details
 
 //----------------------------------
@@ -213,6 +415,25 @@ Viewify<N, Scalar>::operator+=(const details::AXPYResult<N>& rhs)
   return *this;
 }
 
+template <std::size_t N, class Scalar>
+template <class E, class T, typename>
+Viewify<N, Scalar>&
+Viewify<N, Scalar>::operator=(const details::ViewExpression<E>& rhs)
+{
+  const E&   expr  = rhs.self();
+  const long isize = details::ViewTerm<N>(*this).size();
+  Scalar*    data  = data_;
+#ifdef NIMBLE_HAVE_KOKKOS
+  if (isize > details::fused_loop_parallel_threshold) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, isize), [=](long ii) { data[ii] = expr[ii]; });
+    return *this;
+  }
+#endif
+  for (long ii = 0; ii < isize; ++ii) data[ii] = expr[ii];
+  return *this;
+}
+
 template <std::size_t N>
 details::AXPYResult<N>
 operator*(double alpha, const nimble::Viewify<N>& A)
@@ -220,6 +441,60 @@ operator*(double alpha, const nimble::Viewify<N>& A)
   return {A, alpha};
 }
 
+// expression operators live with the expressions, so that argument-dependent
+// lookup finds them for both Viewify and expression operands
+using details::operator*;
+using details::operator+;
+using details::operator-;
+
+/// \brief Evaluate several assignments in one loop over the entries
+///
+/// \param dest, expr Pairs of destination views and expressions
+///
+/// \note Assignments are applied in order for each entry, so a later expression
+/// reads the values just assigned to the same entry, e.g.
+/// `FusedAssign(v, v + dt * a, u, u + dt * v)` matches the two separate statements.
+template <std::size_t N, class E, class... Rest>
+void
+FusedAssign(Viewify<N>& dest, const E& expr, const Rest&... rest)
+{
+  const long isize = details::ViewTerm<N>(dest).size();
+#ifdef NIMBLE_HAVE_KOKKOS
+  if (isize > details::fused_loop_parallel_threshold) {
+    const Viewify<N> dest_view = dest;
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, isize),
+        [=](long ii) { details::AssignEntry(ii, dest_view, expr, rest...); });
+    return;
+  }
+#endif
+  for (long ii = 0; ii < isize; ++ii) { details::AssignEntry(ii, dest, expr, rest...); }
+}
+
+/// \brief Dot product of two expressions, evaluated in one pass
+///
+/// \note The result is local to this rank.
+template <class L, class R, typename = typename std::enable_if<details::ExpressionOperands<L, R>::value>::type>
+double
+Dot(const L& lhs, const R& rhs)
+{
+  const auto lhs_expr = details::ExpressionOperand<L>::convert(lhs);
+  const auto rhs_expr = details::ExpressionOperand<R>::convert(rhs);
+  const long isize    = lhs_expr.size();
+  double     result   = 0.0;
+#ifdef NIMBLE_HAVE_KOKKOS
+  if (isize > details::fused_loop_parallel_threshold) {
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, isize),
+        [=](long ii, double& sum) { sum += lhs_expr[ii] * rhs_expr[ii]; },
+        result);
+    return result;
+  }
+#endif
+  for (long ii = 0; ii < isize; ++ii) result += lhs_expr[ii] * rhs_expr[ii];
+  return result;
+}
+
 //----------------------------------
 
 template <FieldEnum FieldT>
@@ -328,20 +328,31 @@ void
 UqModel::ApplyClosure()
 {
   if (!initialized_) { return; }
+  Interpolate(nominal_force_, forces_);
+}
+//===========================================================================
+void
+UqModel::ApplyDisplacementClosure(const double* nominal_displacement)
+{
+  if (!initialized_) { return; }
+  Interpolate(nominal_displacement, displacements_);
+}
+//===========================================================================
+void
+UqModel::Interpolate(const double* nominal, std::vector<double*>& fields) const
+{
   // Now loop over the approximate samples, and apply the interpolation
   for (int s = 0; s < napprox_samples_; s++) {
-    double* f = forces_[s + nexact_samples_]; // approx after exact
+    double* f = fields[s + nexact_samples_]; // approx after exact
     // Loop over each node
     for (int i = 0; i < nunknowns_; ++i) {
-      f[i] = nominal_force_[i] * interpolation_coefficients_[s][0];  
+      f[i] = nominal[i] * interpolation_coefficients_[s][0];
       for (int k = 0; k < nexact_samples_; k++) {
-        double* f_exact = forces_[k];
+        double* f_exact = fields[k];
         f[i] += f_exact[i] * interpolation_coefficients_[s][k + 1];
       }
-//std::cout << s << " | " << i << ", " << nominal_force_[i] << " / " << f[i] << "\n";
     }
   }
-//std::cout << " DONE ApplyClosure\n" << std::flush;
 }
 //===========================================================================
 }  // namespace nimble
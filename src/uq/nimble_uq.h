@@ -91,6 +91,9 @@ class UqModel
   // construct approx_forces from the exact samples
   void
   ApplyClosure();
+  // construct approx_displacements from the exact samples (quasistatics)
+  void
+  ApplyDisplacementClosure(const double* nominal_displacement);
   // initialization
   void
   ReadSamples();
@@ -155,6 +158,10 @@ class UqModel
   }
 
  private:
+  // interpolate the approximate samples of a field from the exact samples
+  void
+  Interpolate(const double* nominal, std::vector<double*>& fields) const;
+
   int ndims_;    // from mesh
   int nnodes_;   // from mesh
   int nblocks_;  // from mesh
@@ -56,23 +56,23 @@ namespace nimble_uq {
 
 void
 Block::ComputeInternalForce(
-    const double*                   reference_coordinates,
-    const double*                   displacement,
-    const double*                   velocity,
-    double*                         internal_force,
-    double                          time_previous,
-    double                          time_current,
-    int                             num_elem,
-    const int*                      elem_conn,
-    const int*                      elem_global_ids,
-    std::vector<std::string> const& elem_data_labels,
-    std::vector<double> const&      elem_data_n,
-    std::vector<double>&            elem_data_np1,
-    nimble::DataManager&            data_manager,
-    bool                            is_output_step,
-    bool                            use_alternative_parameters,
-    std::map<std::string,double>    alternative_parameters,
-    bool                            compute_stress_only) const
+    const double*                           reference_coordinates,
+    const double*                           displacement,
+    const double*                           velocity,
+    double*                                 internal_force,
+    double                                  time_previous,
+    double                                  time_current,
+    int                                     num_elem,
+    const int*                              elem_conn,
+    const int*                              elem_global_ids,
+    std::vector<std::string> const&         elem_data_labels,
+    std::vector<nimble::StateScalar> const& elem_data_n,
+    std::vector<nimble::StateScalar>&       elem_data_np1,
+    nimble::DataManager&                    data_manager,
+    bool                                    is_output_step,
+    bool                                    use_alternative_parameters,
+    std::map<std::string,double>            alternative_parameters,
+    bool                                    compute_stress_only) const
 {
   if (!use_alternative_parameters) {
     nimble::Block::ComputeInternalForce(
@@ -50,6 +50,7 @@
 #include "nimble_boundary_condition_manager.h"
 #include "nimble_data_manager.h"
 #include "nimble_genesis_mesh.h"
+#include "nimble_macros.h"
 #include "nimble_material_factory.h"
 #include "nimble_model_data.h"
 #include "nimble_parser.h"
@@ -155,6 +156,10 @@ ModelData::ComputeInternalForce(
   int num_samples = uq_model_->GetNumSamples();
   int num_exact_samples = uq_model_->GetNumExactSamples() + 1; // incl nominal
 
+  if (data_manager.GetParser().HasElementFormulation("nodal_averaged")) {
+    NIMBLE_ABORT("\nError in nimble_uq::ModelData::ComputeInternalForce(), nodal averaging is not available with UQ\n");
+  }
+
   force.zero();
   for(int i=0; i < num_samples; i++){ force_views_[i].zero(); }
 
@@ -162,13 +167,13 @@ ModelData::ComputeInternalForce(
   auto velocity        = GetNodeData("velocity"); 
 
   for (auto& block_it : blocks_) {
-    int                        block_id          = block_it.first;
-    int                        num_elem_in_block = mesh.GetNumElementsInBlock(block_id);
-    int const*                 elem_conn         = mesh.GetConnectivity(block_id);
-    std::vector<int> const&    elem_global_ids   = mesh.GetElementGlobalIdsInBlock(block_id);
-    std::vector<double> const& elem_data_n       = GetElementDataOld(block_id);
-    std::vector<double>&       elem_data_np1     = GetElementDataNew(block_id);
-    auto                       block             = dynamic_cast<nimble_uq::Block*>(block_it.second.get());
+    int                                     block_id          = block_it.first;
+    int                                     num_elem_in_block = mesh.GetNumElementsInBlock(block_id);
+    int const*                              elem_conn         = mesh.GetConnectivity(block_id);
+    std::vector<int> const&                 elem_global_ids   = mesh.GetElementGlobalIdsInBlock(block_id);
+    std::vector<nimble::StateScalar> const& elem_data_n       = GetElementDataOld(block_id);
+    std::vector<nimble::StateScalar>&       elem_data_np1     = GetElementDataNew(block_id);
+    auto                                    block             = dynamic_cast<nimble_uq::Block*>(block_it.second.get());
 
     for(int i=0; i < num_exact_samples; i++){
       int ii = i-1;
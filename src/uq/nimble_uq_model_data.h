@@ -129,6 +129,13 @@ class ModelData : public nimble::ModelData
   void
   UpdateWithNewDisplacement(nimble::DataManager& data_manager, double dt) override;
 
+  /// \brief Returns the UQ model holding the exact and approximate samples
+  std::shared_ptr<nimble::UqModel>
+  GetUqModel() const
+  {
+    return uq_model_;
+  }
+
  protected:
   std::shared_ptr<nimble::UqModel> uq_model_;
   std::vector<nimble::Viewify<2>>  displacement_views_;
@@ -45,6 +45,8 @@ def runtestdiff(executable_name, cli_flag, input_deck_name, num_ranks):
         log_file_name = base_name + ".vt.np" + str(num_ranks) + ".log"
     if "use_tpetra" in cli_flag:
         log_file_name = base_name + ".tpetra.np" + str(num_ranks) + ".log"
+    if "overlap_contact" in cli_flag:
+        log_file_name = base_name + ".overlap.np" + str(num_ranks) + ".log"
     if num_ranks > 1:
         epu_exodus_output_name = base_name + ".out." + epu_output_extension
     else:
@@ -0,0 +1,254 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <nimble_element.h>
+#include <nimble_utils.h>
+
+#include <vector>
+
+namespace nimble {
+
+namespace {
+
+//! Exposes the shape functions of a solid element
+template <class Topology>
+class ShapeFunctionElement : public SolidElement<Topology>
+{
+ public:
+  using SolidElement<Topology>::ShapeFunctionValues;
+  using SolidElement<Topology>::ShapeFunctionDerivatives;
+};
+
+//! Natural coordinates of the nodes of the quadratic tetrahedron, the first four are the vertices
+const double tet_node_natural_coords[10][3] = {
+    {0.0, 0.0, 0.0},
+    {1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0},
+    {0.5, 0.0, 0.0},
+    {0.5, 0.5, 0.0},
+    {0.0, 0.5, 0.0},
+    {0.0, 0.0, 0.5},
+    {0.5, 0.0, 0.5},
+    {0.0, 0.5, 0.5}};
+
+//! Points inside the reference tetrahedron
+const std::vector<std::vector<double>> tet_sample_points = {
+    {0.25, 0.25, 0.25},
+    {0.1, 0.2, 0.3},
+    {0.6, 0.1, 0.05},
+    {0.05, 0.7, 0.2},
+    {0.33, 0.01, 0.62}};
+
+//! Distorted quadratic tetrahedron with straight edges
+std::vector<double>
+Tet10Coordinates()
+{
+  const double vertices[4][3] = {{0.1, -0.2, 0.0}, {1.3, 0.1, 0.2}, {0.2, 1.1, -0.1}, {-0.1, 0.3, 0.9}};
+  const int    edges[6][2]    = {{0, 1}, {1, 2}, {2, 0}, {0, 3}, {1, 3}, {2, 3}};
+
+  std::vector<double> coords(30);
+  for (int n = 0; n < 4; n++) {
+    for (int i = 0; i < 3; i++) { coords[3 * n + i] = vertices[n][i]; }
+  }
+  for (int e = 0; e < 6; e++) {
+    for (int i = 0; i < 3; i++) { coords[3 * (4 + e) + i] = 0.5 * (vertices[edges[e][0]][i] + vertices[edges[e][1]][i]); }
+  }
+  return coords;
+}
+
+//! x = A X + c
+std::vector<double>
+AffineMap(const std::vector<double>& coords, const double A[3][3])
+{
+  const double        c[] = {0.3, -0.1, 0.2};
+  std::vector<double> mapped(coords.size());
+  for (size_t n = 0; n < coords.size() / 3; n++) {
+    for (int i = 0; i < 3; i++) {
+      mapped[3 * n + i] = c[i];
+      for (int j = 0; j < 3; j++) { mapped[3 * n + i] += A[i][j] * coords[3 * n + j]; }
+    }
+  }
+  return mapped;
+}
+
+const double affine_gradient[3][3] = {{1.1, 0.05, -0.02}, {0.03, 0.95, 0.04}, {-0.01, 0.02, 1.05}};
+
+const int full_tensor_index[3][3] = {{K_F_XX, K_F_XY, K_F_XZ}, {K_F_YX, K_F_YY, K_F_YZ}, {K_F_ZX, K_F_ZY, K_F_ZZ}};
+
+template <class Topology>
+void
+CheckShapeFunctions()
+{
+  constexpr int                  num_nodes = Topology::num_nodes;
+  ShapeFunctionElement<Topology> element;
+  double                         values[num_nodes];
+  double                         derivatives[num_nodes * 3];
+
+  for (const auto& point : tet_sample_points) {
+    element.ShapeFunctionValues(point.data(), values);
+    element.ShapeFunctionDerivatives(point.data(), derivatives);
+
+    double sum = 0.0;
+    for (int n = 0; n < num_nodes; n++) { sum += values[n]; }
+    EXPECT_NEAR(sum, 1.0, 1.0e-14);
+
+    for (int i = 0; i < 3; i++) {
+      double derivative_sum = 0.0;
+      for (int n = 0; n < num_nodes; n++) { derivative_sum += derivatives[3 * n + i]; }
+      EXPECT_NEAR(derivative_sum, 0.0, 1.0e-14);
+    }
+
+    // The derivatives agree with central differences of the values
+    const double h = 1.0e-6;
+    for (int i = 0; i < 3; i++) {
+      std::vector<double> plus(point), minus(point);
+      plus[i] += h;
+      minus[i] -= h;
+      double values_plus[num_nodes], values_minus[num_nodes];
+      element.ShapeFunctionValues(plus.data(), values_plus);
+      element.ShapeFunctionValues(minus.data(), values_minus);
+      for (int n = 0; n < num_nodes; n++) {
+        EXPECT_NEAR(derivatives[3 * n + i], (values_plus[n] - values_minus[n]) / (2.0 * h), 1.0e-8);
+      }
+    }
+  }
+
+  // Kronecker delta property at the nodes
+  for (int m = 0; m < num_nodes; m++) {
+    element.ShapeFunctionValues(tet_node_natural_coords[m], values);
+    for (int n = 0; n < num_nodes; n++) { EXPECT_NEAR(values[n], (m == n) ? 1.0 : 0.0, 1.0e-14); }
+  }
+}
+
+template <class ElementType>
+void
+CheckAffineDeformationGradient(const std::vector<double>& reference_coords)
+{
+  constexpr int       num_int_pts = Tet10Topology::num_int_pts;
+  ElementType         element;
+  std::vector<double> current_coords = AffineMap(reference_coords, affine_gradient);
+  double              def_grad[9 * num_int_pts];
+
+  element.ComputeDeformationGradients(reference_coords.data(), current_coords.data(), def_grad);
+  for (int int_pt = 0; int_pt < num_int_pts; int_pt++) {
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++) {
+        EXPECT_NEAR(def_grad[9 * int_pt + full_tensor_index[i][j]], affine_gradient[i][j], 1.0e-12);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(nimble_element, tet4_partition_of_unity) { CheckShapeFunctions<Tet4Topology>(); }
+
+TEST(nimble_element, tet10_partition_of_unity) { CheckShapeFunctions<Tet10Topology>(); }
+
+TEST(nimble_element, tet10_affine_deformation_gradient)
+{
+  CheckAffineDeformationGradient<Tet10Element>(Tet10Coordinates());
+}
+
+TEST(nimble_element, composite_tet10_affine_deformation_gradient)
+{
+  CheckAffineDeformationGradient<CompositeTet10Element>(Tet10Coordinates());
+}
+
+TEST(nimble_element, composite_tet10_projected_gradients)
+{
+  constexpr int         num_nodes   = Tet10Topology::num_nodes;
+  constexpr int         num_int_pts = Tet10Topology::num_int_pts;
+  CompositeTet10Element element;
+  std::vector<double>   coords = Tet10Coordinates();
+  double                proj_grad[num_int_pts * num_nodes * 3];
+
+  // Sum of the projected gradients vanishes, and they reproduce the gradient of x
+  double volume = element.ProjectedGradientsKernel(coords.data(), proj_grad);
+  for (int int_pt = 0; int_pt < num_int_pts; int_pt++) {
+    const double* grad = &proj_grad[num_nodes * 3 * int_pt];
+    for (int i = 0; i < 3; i++) {
+      double sum = 0.0;
+      for (int n = 0; n < num_nodes; n++) { sum += grad[3 * n + i]; }
+      EXPECT_NEAR(sum, 0.0, 1.0e-12);
+      for (int j = 0; j < 3; j++) {
+        double dx_dx = 0.0;
+        for (int n = 0; n < num_nodes; n++) { dx_dx += coords[3 * n + i] * grad[3 * n + j]; }
+        EXPECT_NEAR(dx_dx, (i == j) ? 1.0 : 0.0, 1.0e-12);
+      }
+    }
+  }
+
+  // The sub-tetrahedra fill the parent element
+  double a[3][3];
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) { a[i][j] = coords[3 * (j + 1) + i] - coords[i]; }
+  }
+  double parent_volume = (a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+                          a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+                          a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0])) /
+                         6.0;
+  EXPECT_NEAR(volume, parent_volume, 1.0e-14);
+}
+
+TEST(nimble_element, composite_tet10_lumped_mass)
+{
+  constexpr int         num_nodes = Tet10Topology::num_nodes;
+  CompositeTet10Element element;
+  std::vector<double>   coords = Tet10Coordinates();
+  double                mass[num_nodes];
+  double                volume;
+  const double          density = 7.8;
+
+  element.ComputeLumpedMass(density, coords.data(), mass);
+  element.ComputeVolumeAverage(coords.data(), 0, nullptr, volume, nullptr);
+
+  double total = 0.0;
+  for (int n = 0; n < num_nodes; n++) {
+    EXPECT_GT(mass[n], 0.0);
+    total += mass[n];
+  }
+  EXPECT_NEAR(total, density * volume, 1.0e-12);
+}
+
+}  // namespace nimble
@@ -0,0 +1,188 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+
+#include <gtest/gtest.h>
+#include <nimble_element.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace nimble {
+
+namespace {
+
+//! Natural coordinates of the nodes of the trilinear hexahedron
+const double hex_node_natural_coords[8][3] = {
+    {-1.0, -1.0, -1.0},
+    {1.0, -1.0, -1.0},
+    {1.0, 1.0, -1.0},
+    {-1.0, 1.0, -1.0},
+    {-1.0, -1.0, 1.0},
+    {1.0, -1.0, 1.0},
+    {1.0, 1.0, 1.0},
+    {-1.0, 1.0, 1.0}};
+
+//! Natural coordinates of the nodes of the quadratic tetrahedron
+const double tet10_node_natural_coords[10][3] = {
+    {0.0, 0.0, 0.0},
+    {1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0},
+    {0.5, 0.0, 0.0},
+    {0.5, 0.5, 0.0},
+    {0.0, 0.5, 0.0},
+    {0.0, 0.0, 0.5},
+    {0.5, 0.0, 0.5},
+    {0.0, 0.5, 0.5}};
+
+//! Reference and current coordinates of element elem, every node moved differently
+void
+TestCoordinates(
+    const double (*natural_coords)[3],
+    int                  num_nodes,
+    int                  elem,
+    std::vector<double>& ref_coords,
+    std::vector<double>& cur_coords)
+{
+  ref_coords.resize(3 * num_nodes);
+  cur_coords.resize(3 * num_nodes);
+  for (int n = 0; n < num_nodes; n++) {
+    for (int i = 0; i < 3; i++) {
+      double s              = 0.002 * (elem + 1) * std::sin(1.3 * n + 0.7 * i + elem);
+      ref_coords[3 * n + i] = 0.5 * natural_coords[n][i] + elem + s;
+      cur_coords[3 * n + i] = ref_coords[3 * n + i] * (1.0 + 0.02 * i) + 0.5 * s * s + 0.005 * std::cos(n + i + elem);
+    }
+  }
+}
+
+//! Stress of element elem, each component and point different
+void
+TestStresses(int num_int_pts, int elem, std::vector<double>& stresses)
+{
+  stresses.resize(6 * num_int_pts);
+  for (int k = 0; k < 6 * num_int_pts; k++) { stresses[k] = 1.0e3 * std::sin(0.37 * k + 1.1 * elem + 0.2); }
+}
+
+//! Largest magnitude entry, the scale of the rounding differences between the kernels
+double
+MaxAbs(const std::vector<double>& values)
+{
+  double scale = 0.0;
+  for (double value : values) scale = std::max(scale, std::abs(value));
+  return scale;
+}
+
+//! Runs the batched kernels over num_elem elements, a partial final batch included,
+//! and compares each element with the single element kernels
+void
+CheckBatchedKernels(Element& element, const double (*natural_coords)[3], int num_elem)
+{
+  constexpr int width          = NIMBLE_ELEMENT_BATCH_WIDTH;
+  const int     num_nodes      = element.NumNodesPerElement();
+  const int     num_int_pts    = element.NumIntegrationPointsPerElement();
+  const int     node_data_size = 3 * num_nodes;
+  const int     def_grad_size  = 9 * num_int_pts;
+  const int     stress_size    = 6 * num_int_pts;
+  const double  untouched      = -7.0;
+
+  std::vector<double> ref_coords, cur_coords, stresses, def_grad(def_grad_size), force(node_data_size);
+  for (int first = 0; first < num_elem; first += width) {
+    const int num_lanes = std::min(width, num_elem - first);
+
+    std::vector<double> ref_batch(node_data_size * width, 0.0), cur_batch(node_data_size * width, 0.0);
+    std::vector<double> stress_batch(stress_size * width, 0.0);
+    std::vector<double> def_grad_batch(def_grad_size * width, untouched), force_batch(node_data_size * width, untouched);
+    for (int lane = 0; lane < num_lanes; lane++) {
+      TestCoordinates(natural_coords, num_nodes, first + lane, ref_coords, cur_coords);
+      TestStresses(num_int_pts, first + lane, stresses);
+      for (int i = 0; i < node_data_size; i++) {
+        ref_batch[i * width + lane] = ref_coords[i];
+        cur_batch[i * width + lane] = cur_coords[i];
+      }
+      for (int i = 0; i < stress_size; i++) { stress_batch[i * width + lane] = stresses[i]; }
+    }
+
+    element.ComputeDeformationGradientsBatch(num_lanes, ref_batch.data(), cur_batch.data(), def_grad_batch.data());
+    element.ComputeNodalForcesBatch(num_lanes, cur_batch.data(), stress_batch.data(), force_batch.data());
+
+    for (int lane = 0; lane < num_lanes; lane++) {
+      const int elem = first + lane;
+      TestCoordinates(natural_coords, num_nodes, elem, ref_coords, cur_coords);
+      TestStresses(num_int_pts, elem, stresses);
+      element.ComputeDeformationGradients(ref_coords.data(), cur_coords.data(), def_grad.data());
+      element.ComputeNodalForces(cur_coords.data(), stresses.data(), force.data());
+
+      // the batched kernels may group the arithmetic differently
+      const double def_grad_scale = MaxAbs(def_grad);
+      const double force_scale    = MaxAbs(force);
+      for (int i = 0; i < def_grad_size; i++) {
+        EXPECT_NEAR(def_grad_batch[i * width + lane], def_grad[i], 1.0e-13 * def_grad_scale)
+            << "element " << elem << " entry " << i;
+      }
+      for (int i = 0; i < node_data_size; i++) {
+        EXPECT_NEAR(force_batch[i * width + lane], force[i], 1.0e-13 * force_scale)
+            << "element " << elem << " entry " << i;
+      }
+    }
+    for (int lane = num_lanes; lane < width; lane++) {
+      for (int i = 0; i < def_grad_size; i++) { EXPECT_EQ(def_grad_batch[i * width + lane], untouched); }
+      for (int i = 0; i < node_data_size; i++) { EXPECT_EQ(force_batch[i * width + lane], untouched); }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(nimble_element_batch, hex_matches_single_element)
+{
+  HexElement element;
+  CheckBatchedKernels(element, hex_node_natural_coords, NIMBLE_ELEMENT_BATCH_WIDTH + 3);
+}
+
+TEST(nimble_element_batch, default_kernels_match_single_element)
+{
+  Tet10Element element;
+  CheckBatchedKernels(element, tet10_node_natural_coords, NIMBLE_ELEMENT_BATCH_WIDTH + 3);
+}
+
+}  // namespace nimble
@@ -0,0 +1,184 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <nimble_block.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace nimble {
+
+namespace {
+
+//! Connectivity of a cube of n x n x n hexes, optionally with shuffled node and element numbers
+std::vector<int>
+HexCubeConnectivity(int n, bool shuffle)
+{
+  int              num_nodes = (n + 1) * (n + 1) * (n + 1);
+  std::vector<int> node_number(num_nodes);
+  std::iota(node_number.begin(), node_number.end(), 0);
+  std::vector<int> elem_order(n * n * n);
+  std::iota(elem_order.begin(), elem_order.end(), 0);
+  if (shuffle) {
+    std::mt19937 generator(7);
+    std::shuffle(node_number.begin(), node_number.end(), generator);
+    std::shuffle(elem_order.begin(), elem_order.end(), generator);
+  }
+
+  auto             node_id = [&](int i, int j, int k) { return node_number[(k * (n + 1) + j) * (n + 1) + i]; };
+  std::vector<int> conn;
+  for (int elem : elem_order) {
+    int i = elem % n, j = (elem / n) % n, k = elem / (n * n);
+    for (int kk = 0; kk < 2; kk++) {
+      conn.push_back(node_id(i, j, k + kk));
+      conn.push_back(node_id(i + 1, j, k + kk));
+      conn.push_back(node_id(i + 1, j + 1, k + kk));
+      conn.push_back(node_id(i, j + 1, k + kk));
+    }
+  }
+  return conn;
+}
+
+}  // namespace
+
+TEST(nimble_element_tiling, each_element_in_one_tile)
+{
+  const int        n = 12, max_nodes_per_tile = 200;
+  std::vector<int> conn     = HexCubeConnectivity(n, true);
+  int              num_elem = n * n * n;
+
+  ElementTiling tiling;
+  tiling.Build(num_elem, 8, conn.data(), max_nodes_per_tile);
+  EXPECT_TRUE(tiling.Matches(num_elem, conn.data()));
+
+  std::vector<int> tile_count(num_elem, 0);
+  for (int tile = 0; tile < tiling.NumTiles(); tile++) {
+    int first_node = tiling.tile_first_node[tile];
+    EXPECT_LE(tiling.tile_first_node[tile + 1] - first_node, max_nodes_per_tile);
+    for (int k = tiling.tile_first_elem[tile]; k < tiling.tile_first_elem[tile + 1]; k++) {
+      int elem = tiling.tile_elems[k];
+      tile_count[elem]++;
+      for (int node = 0; node < 8; node++) {
+        int local = tiling.local_elem_conn[elem * 8 + node];
+        EXPECT_EQ(tiling.tile_node_ids[first_node + local], conn[elem * 8 + node]);
+      }
+    }
+  }
+  for (int elem = 0; elem < num_elem; elem++) { EXPECT_EQ(tile_count[elem], 1); }
+}
+
+TEST(nimble_element_tiling, shuffled_mesh_keeps_locality)
+{
+  // The nodes gathered by all the tiles count the nodes on the tile interfaces
+  // several times, compact tiles keep that overhead low whatever the numbering
+  const int n = 16, max_nodes_per_tile = 455;
+  int       num_elem  = n * n * n;
+  int       num_nodes = (n + 1) * (n + 1) * (n + 1);
+
+  std::vector<int> ordered_conn  = HexCubeConnectivity(n, false);
+  std::vector<int> shuffled_conn = HexCubeConnectivity(n, true);
+  ElementTiling    ordered, shuffled;
+  ordered.Build(num_elem, 8, ordered_conn.data(), max_nodes_per_tile);
+  shuffled.Build(num_elem, 8, shuffled_conn.data(), max_nodes_per_tile);
+
+  // Tiles of consecutive elements gather 31330 nodes on the shuffled mesh
+  double num_ordered_tile_nodes  = ordered.tile_node_ids.size();
+  double num_shuffled_tile_nodes = shuffled.tile_node_ids.size();
+  EXPECT_LT(num_ordered_tile_nodes, 2.0 * num_nodes);
+  EXPECT_LT(num_shuffled_tile_nodes, 1.1 * num_ordered_tile_nodes);
+}
+
+TEST(nimble_element_tiling, enough_tiles_for_the_threads)
+{
+  const int        n        = 8;
+  std::vector<int> conn     = HexCubeConnectivity(n, true);
+  int              num_elem = n * n * n;
+
+  ElementTiling tiling;
+  tiling.Build(num_elem, 8, conn.data(), 100000);
+  EXPECT_EQ(tiling.NumTiles(), 1);
+  tiling.Build(num_elem, 8, conn.data(), 100000, 16);
+  EXPECT_GE(tiling.NumTiles(), 16);
+}
+
+TEST(nimble_element_tiling, boundary_tiles_hold_only_the_boundary_elements)
+{
+  // The nodes on the x = 0 face are shared with another rank
+  const int        n = 12, max_nodes_per_tile = 200;
+  std::vector<int> conn      = HexCubeConnectivity(n, false);
+  int              num_elem  = n * n * n;
+  int              num_nodes = (n + 1) * (n + 1) * (n + 1);
+
+  std::vector<char> node_is_shared(num_nodes, 0);
+  for (int node = 0; node < num_nodes; node += n + 1) { node_is_shared[node] = 1; }
+
+  ElementTiling tiling;
+  tiling.Build(num_elem, 8, conn.data(), max_nodes_per_tile, 1, &node_is_shared);
+  EXPECT_TRUE(tiling.IsClassified());
+  EXPECT_EQ(tiling.boundary_tiles.size() + tiling.interior_tiles.size(), static_cast<size_t>(tiling.NumTiles()));
+
+  auto touches_shared_node = [&](int elem) {
+    bool is_shared = false;
+    for (int node = 0; node < 8; node++) { is_shared = is_shared || node_is_shared[conn[elem * 8 + node]]; }
+    return is_shared;
+  };
+  int num_boundary_elems = 0;
+  for (int tile : tiling.boundary_tiles) {
+    for (int k = tiling.tile_first_elem[tile]; k < tiling.tile_first_elem[tile + 1]; k++) {
+      EXPECT_TRUE(touches_shared_node(tiling.tile_elems[k]));
+      num_boundary_elems++;
+    }
+  }
+  for (int tile : tiling.interior_tiles) {
+    for (int k = tiling.tile_first_elem[tile]; k < tiling.tile_first_elem[tile + 1]; k++) {
+      EXPECT_FALSE(touches_shared_node(tiling.tile_elems[k]));
+    }
+  }
+  EXPECT_EQ(num_boundary_elems, n * n);
+
+  tiling.Build(num_elem, 8, conn.data(), max_nodes_per_tile);
+  EXPECT_FALSE(tiling.IsClassified());
+}
+
+}  // namespace nimble
@@ -0,0 +1,143 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <nimble_material.h>
+#include <nimble_utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace nimble {
+
+namespace {
+
+//! Exposes the single point stress update of a material
+template <class MaterialT>
+class PointMaterial : public MaterialT
+{
+ public:
+  using MaterialT::GetStress;
+  using MaterialT::MaterialT;
+};
+
+//! Deformation gradient of lane lane and point pt, a different stretch and shear for each
+void
+TestDeformationGradient(int lane, int pt, double* def_grad)
+{
+  double s         = 0.01 * (lane + 1) + 0.003 * pt;
+  def_grad[K_F_XX] = 1.0 + s;
+  def_grad[K_F_YY] = 1.0 - 0.4 * s;
+  def_grad[K_F_ZZ] = 1.0 - 0.3 * s;
+  def_grad[K_F_XY] = 0.5 * s;
+  def_grad[K_F_YZ] = -0.2 * s;
+  def_grad[K_F_ZX] = 0.1 * s;
+  def_grad[K_F_YX] = 0.3 * s;
+  def_grad[K_F_ZY] = 0.05 * s;
+  def_grad[K_F_XZ] = -0.15 * s;
+}
+
+//! Compares the lanes of the batched stress with the stress of each element on its own
+template <class MaterialT>
+void
+CheckBatchedStress(const PointMaterial<MaterialT>& material)
+{
+  constexpr int width     = NIMBLE_ELEMENT_BATCH_WIDTH;
+  const int     num_pts   = 8;
+  const int     num_lanes = width - 1;  // a partial batch leaves the last lane untouched
+
+  std::vector<double> def_grad_batch(9 * num_pts * width, 0.0);
+  std::vector<double> stress_batch(6 * num_pts * width, -1.0);
+  for (int lane = 0; lane < num_lanes; lane++) {
+    for (int pt = 0; pt < num_pts; pt++) {
+      double f[9];
+      TestDeformationGradient(lane, pt, f);
+      for (int k = 0; k < 9; k++) { def_grad_batch[(9 * pt + k) * width + lane] = f[k]; }
+    }
+  }
+
+  material.GetStressLanes(num_lanes, num_pts, def_grad_batch.data(), stress_batch.data());
+
+  nimble::Viewify<1, const double> null_view;
+  for (int lane = 0; lane < num_lanes; lane++) {
+    for (int pt = 0; pt < num_pts; pt++) {
+      double f[9], sig[6];
+      TestDeformationGradient(lane, pt, f);
+      nimble::Viewify<1, const double> def_grad(f, 9);
+      material.GetStress(0.0, 1.0, null_view, def_grad, null_view, {sig, 6});
+      // the batched kernels may group the arithmetic differently
+      double scale = 0.0;
+      for (double value : sig) scale = std::max(scale, std::abs(value));
+      for (int k = 0; k < 6; k++) {
+        EXPECT_NEAR(stress_batch[(6 * pt + k) * width + lane], sig[k], 1.0e-12 * scale)
+            << "lane " << lane << " point " << pt;
+      }
+    }
+  }
+  for (int i = 0; i < 6 * num_pts; i++) { EXPECT_EQ(stress_batch[i * width + width - 1], -1.0); }
+}
+
+MaterialParameters
+TestParameters(const std::string& name)
+{
+  std::map<std::string, double> double_params = {
+      {"density", 7.8e3}, {"bulk_modulus", 1.6e11}, {"shear_modulus", 0.8e11}};
+  return MaterialParameters(name, {}, double_params);
+}
+
+}  // namespace
+
+TEST(nimble_material_batch, elastic_matches_single_element)
+{
+  PointMaterial<ElasticMaterial> material(TestParameters("elastic"));
+  CheckBatchedStress(material);
+}
+
+TEST(nimble_material_batch, neohookean_matches_single_element)
+{
+  PointMaterial<NeohookeanMaterial> material(TestParameters("neohookean"));
+  CheckBatchedStress(material);
+}
+
+}  // namespace nimble
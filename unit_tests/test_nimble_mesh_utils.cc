@@ -0,0 +1,163 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <nimble_genesis_mesh.h>
+#include <nimble_mesh_utils.h>
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace nimble {
+
+namespace {
+
+//! Brick of nx x ny x nz unit hexes, the last layer of elements in a second block
+GenesisMesh
+HexBrickMesh(int nx, int ny, int nz)
+{
+  auto node_id = [&](int i, int j, int k) { return (k * (ny + 1) + j) * (nx + 1) + i; };
+
+  std::vector<int>    node_global_id;
+  std::vector<double> node_x, node_y, node_z;
+  for (int k = 0; k <= nz; k++) {
+    for (int j = 0; j <= ny; j++) {
+      for (int i = 0; i <= nx; i++) {
+        node_global_id.push_back(node_id(i, j, k));
+        node_x.push_back(i);
+        node_y.push_back(j);
+        node_z.push_back(k);
+      }
+    }
+  }
+
+  std::vector<int>                elem_global_id;
+  std::vector<int>                block_ids   = {1, 2};
+  std::map<int, std::string>      block_names = {{1, "block_1"}, {2, "block_2"}};
+  std::map<int, std::vector<int>> block_elem_global_ids, block_elem_connectivity;
+  std::map<int, int>              block_num_nodes_per_elem = {{1, 8}, {2, 8}};
+  for (int k = 0; k < nz; k++) {
+    int block_id = (k == nz - 1) ? 2 : 1;
+    for (int j = 0; j < ny; j++) {
+      for (int i = 0; i < nx; i++) {
+        int elem_id = static_cast<int>(elem_global_id.size());
+        elem_global_id.push_back(elem_id);
+        block_elem_global_ids[block_id].push_back(elem_id);
+        std::vector<int>& conn = block_elem_connectivity[block_id];
+        for (int kk = 0; kk < 2; kk++) {
+          conn.push_back(node_id(i, j, k + kk));
+          conn.push_back(node_id(i + 1, j, k + kk));
+          conn.push_back(node_id(i + 1, j + 1, k + kk));
+          conn.push_back(node_id(i, j + 1, k + kk));
+        }
+      }
+    }
+  }
+
+  GenesisMesh mesh;
+  mesh.Initialize(
+      "hex_brick",
+      node_global_id,
+      node_x,
+      node_y,
+      node_z,
+      elem_global_id,
+      block_ids,
+      block_names,
+      block_elem_global_ids,
+      block_num_nodes_per_elem,
+      block_elem_connectivity);
+  return mesh;
+}
+
+}  // namespace
+
+TEST(nimble_mesh_utils, tangent_row_structure_matches_element_assembly)
+{
+  GenesisMesh mesh      = HexBrickMesh(3, 2, 2);
+  int         dim       = mesh.GetDim();
+  int         num_nodes = mesh.GetNumNodes();
+
+  // number the linear system backwards so the mapping is exercised
+  std::vector<int> linear_system_node_ids(num_nodes);
+  for (int i = 0; i < num_nodes; i++) { linear_system_node_ids[i] = num_nodes - 1 - i; }
+
+  // column indices of each row, assembled element by element
+  std::vector<std::set<int>> nonzeros(num_nodes * dim);
+  for (auto const& block_id : mesh.GetBlockIds()) {
+    int        num_elem           = mesh.GetNumElementsInBlock(block_id);
+    int        num_nodes_per_elem = mesh.GetNumNodesPerElement(block_id);
+    int const* elem_conn          = mesh.GetConnectivity(block_id);
+    for (int i_elem = 0; i_elem < num_elem; i_elem++) {
+      for (int i = 0; i < num_nodes_per_elem * dim; i++) {
+        for (int j = 0; j < num_nodes_per_elem * dim; j++) {
+          int row = linear_system_node_ids[elem_conn[num_nodes_per_elem * i_elem + i / dim]] * dim + i % dim;
+          int col = linear_system_node_ids[elem_conn[num_nodes_per_elem * i_elem + j / dim]] * dim + j % dim;
+          nonzeros[row].insert(col);
+        }
+      }
+    }
+  }
+
+  std::vector<int> row_first_index, j_index;
+  DetermineTangentMatrixRowStructure(mesh, linear_system_node_ids, row_first_index, j_index);
+
+  ASSERT_EQ(row_first_index.size(), nonzeros.size() + 1);
+  ASSERT_EQ(row_first_index.back(), static_cast<int>(j_index.size()));
+  for (std::size_t i_row = 0; i_row < nonzeros.size(); i_row++) {
+    std::vector<int> expected(nonzeros[i_row].begin(), nonzeros[i_row].end());
+    std::vector<int> computed(j_index.begin() + row_first_index[i_row], j_index.begin() + row_first_index[i_row + 1]);
+    EXPECT_EQ(computed, expected) << "row " << i_row;
+  }
+
+  // the coordinate format lists the same nonzeros row by row
+  std::vector<int> i_index, j_index_coo;
+  DetermineTangentMatrixNonzeroStructure(mesh, linear_system_node_ids, i_index, j_index_coo);
+  ASSERT_EQ(i_index.size(), j_index.size());
+  EXPECT_EQ(j_index_coo, j_index);
+  for (int i_row = 0; i_row < num_nodes * dim; i_row++) {
+    for (int i = row_first_index[i_row]; i < row_first_index[i_row + 1]; i++) { EXPECT_EQ(i_index[i], i_row); }
+  }
+}
+
+}  // namespace nimble
@@ -0,0 +1,126 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <nimble_material.h>
+#include <nimble_utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+
+namespace nimble {
+
+namespace {
+
+//! Exposes the single point stress update of the neohookean model
+class NeohookeanPointMaterial : public NeohookeanMaterial
+{
+ public:
+  using NeohookeanMaterial::GetStress;
+  using NeohookeanMaterial::NeohookeanMaterial;
+};
+
+//! Neohookean stress rebuilt from the left stretch of a polar decomposition
+void
+PolarDecompositionStress(double bulk_modulus, double shear_modulus, const double* def_grad, double* stress)
+{
+  double v[6], r[9];
+  Polar_Decomp(def_grad, v, r);
+
+  double xj = v[K_S_XX] * v[K_S_YY] * v[K_S_ZZ] + 2.0 * v[K_S_XY] * v[K_S_YZ] * v[K_S_ZX] -
+              v[K_S_XX] * v[K_S_YZ] * v[K_S_YZ] - v[K_S_YY] * v[K_S_ZX] * v[K_S_ZX] - v[K_S_ZZ] * v[K_S_XY] * v[K_S_XY];
+
+  double b[6];
+  b[K_S_XX] = v[K_S_XX] * v[K_S_XX] + v[K_S_XY] * v[K_S_YX] + v[K_S_XZ] * v[K_S_ZX];
+  b[K_S_YY] = v[K_S_YX] * v[K_S_XY] + v[K_S_YY] * v[K_S_YY] + v[K_S_YZ] * v[K_S_ZY];
+  b[K_S_ZZ] = v[K_S_ZX] * v[K_S_XZ] + v[K_S_ZY] * v[K_S_YZ] + v[K_S_ZZ] * v[K_S_ZZ];
+  b[K_S_XY] = v[K_S_XX] * v[K_S_XY] + v[K_S_XY] * v[K_S_YY] + v[K_S_XZ] * v[K_S_ZY];
+  b[K_S_YZ] = v[K_S_YX] * v[K_S_XZ] + v[K_S_YY] * v[K_S_YZ] + v[K_S_YZ] * v[K_S_ZZ];
+  b[K_S_ZX] = v[K_S_ZX] * v[K_S_XX] + v[K_S_ZY] * v[K_S_YX] + v[K_S_ZZ] * v[K_S_ZX];
+
+  double fac      = 1.0 / std::pow(xj, 2.0 / 3.0);
+  double pressure = 0.5 * bulk_modulus * (xj - 1.0 / xj);
+  double trace    = fac * (b[K_S_XX] + b[K_S_YY] + b[K_S_ZZ]);
+
+  stress[K_S_XX] = pressure + shear_modulus * (fac * b[K_S_XX] - trace / 3.0) / xj;
+  stress[K_S_YY] = pressure + shear_modulus * (fac * b[K_S_YY] - trace / 3.0) / xj;
+  stress[K_S_ZZ] = pressure + shear_modulus * (fac * b[K_S_ZZ] - trace / 3.0) / xj;
+  stress[K_S_XY] = shear_modulus * fac * b[K_S_XY] / xj;
+  stress[K_S_YZ] = shear_modulus * fac * b[K_S_YZ] / xj;
+  stress[K_S_ZX] = shear_modulus * fac * b[K_S_ZX] / xj;
+}
+
+}  // namespace
+
+TEST(nimble_neohookean, left_cauchy_green_matches_polar_decomposition)
+{
+  const double                  bulk_modulus = 1.6e11, shear_modulus = 0.8e11;
+  std::map<std::string, double> double_params = {
+      {"density", 7.8e3}, {"bulk_modulus", bulk_modulus}, {"shear_modulus", shear_modulus}};
+  NeohookeanPointMaterial material(MaterialParameters("neohookean", {}, double_params));
+
+  // stretch, compression, shear and a finite rotation, in full tensor storage
+  const double def_grads[][9] = {
+      {1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.1, 0.97, 0.97, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {0.8, 1.05, 1.02, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.0, 1.0, 1.0, 0.3, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {1.05, 0.95, 1.1, 0.12, -0.07, 0.04, 0.2, -0.15, 0.09},
+      {0.0, 0.0, 1.2, -1.1, 0.0, 0.0, 0.9, 0.0, 0.0},
+  };
+
+  for (const auto& f : def_grads) {
+    double expected[6], computed[6];
+    PolarDecompositionStress(bulk_modulus, shear_modulus, f, expected);
+
+    nimble::Viewify<1, const double> null_view;
+    nimble::Viewify<1, const double> def_grad(f, 9);
+    material.GetStress(0.0, 1.0, null_view, def_grad, null_view, {computed, 6});
+
+    double scale = 0.0;
+    for (double s : expected) scale = std::max(scale, std::abs(s));
+    for (int k = 0; k < 6; k++) { EXPECT_NEAR(computed[k], expected[k], 1.0e-10 * scale + 1.0e-6) << "entry " << k; }
+  }
+}
+
+}  // namespace nimble
@@ -0,0 +1,149 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <nimble_contact_manager.h>
+#include <nimble_parser.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace nimble {
+
+namespace {
+
+// Exposes the parsing of a single "key: value" line
+class KeyValueParser : public Parser
+{
+ public:
+  using Parser::ParseKeyValue;
+};
+
+}  // namespace
+
+TEST(nimble_parser, block_properties_default_formulation)
+{
+  BlockProperties props("block_12 material_1");
+  EXPECT_EQ(props.block_name_, "block_12");
+  EXPECT_EQ(props.block_id_, 12);
+  EXPECT_EQ(props.material_key_, "material_1");
+  EXPECT_EQ(props.element_formulation_, "standard");
+}
+
+TEST(nimble_parser, block_properties_formulation)
+{
+  BlockProperties composite("block_1 material_1 formulation composite");
+  EXPECT_EQ(composite.material_key_, "material_1");
+  EXPECT_EQ(composite.element_formulation_, "composite");
+
+  BlockProperties nodal_averaged("block_2   material_2   formulation   nodal_averaged");
+  EXPECT_EQ(nodal_averaged.block_id_, 2);
+  EXPECT_EQ(nodal_averaged.element_formulation_, "nodal_averaged");
+}
+
+TEST(nimble_parser, block_properties_invalid)
+{
+  EXPECT_THROW(BlockProperties("block_1"), std::invalid_argument);
+  EXPECT_THROW(BlockProperties("block_1 material_1 composite"), std::invalid_argument);
+  EXPECT_THROW(BlockProperties("block_1 material_1 formulation"), std::invalid_argument);
+  EXPECT_THROW(BlockProperties("block_1 material_1 formulation mixed"), std::invalid_argument);
+}
+
+TEST(nimble_parser, contact_interaction_defaults)
+{
+  auto interaction = ParseContactInteraction(
+      "primary_blocks block_1 block_2 secondary_blocks block_3 penalty_parameter 1.0e3", "contact_1", 4);
+  EXPECT_EQ(interaction.name, "contact_1");
+  EXPECT_EQ(interaction.dicing, 4);
+  EXPECT_EQ(interaction.primary_block_names, (std::vector<std::string>{"block_1", "block_2"}));
+  EXPECT_EQ(interaction.secondary_block_names, (std::vector<std::string>{"block_3"}));
+  EXPECT_DOUBLE_EQ(interaction.penalty_parameter, 1.0e3);
+}
+
+TEST(nimble_parser, contact_interaction_name_and_dicing)
+{
+  auto interaction = ParseContactInteraction(
+      "name fasteners primary_blocks block_1 secondary_blocks block_2 block_3 penalty_parameter 2.5e11 dicing 3",
+      "contact_2",
+      1);
+  EXPECT_EQ(interaction.name, "fasteners");
+  EXPECT_EQ(interaction.dicing, 3);
+  EXPECT_EQ(interaction.primary_block_names, (std::vector<std::string>{"block_1"}));
+  EXPECT_EQ(interaction.secondary_block_names, (std::vector<std::string>{"block_2", "block_3"}));
+  EXPECT_DOUBLE_EQ(interaction.penalty_parameter, 2.5e11);
+}
+
+TEST(nimble_parser, contact_interaction_invalid)
+{
+  EXPECT_THROW(ParseContactInteraction("name", "contact_1", 1), std::invalid_argument);
+  EXPECT_THROW(
+      ParseContactInteraction(
+          "primary_blocks block_1 secondary_blocks block_2 penalty_parameter 1.0 dicing 0", "contact_1", 1),
+      std::invalid_argument);
+  EXPECT_THROW(
+      ParseContactInteraction("primary_blocks block_1 block_2 penalty_parameter 1.0", "contact_1", 1),
+      std::invalid_argument);
+}
+
+TEST(nimble_parser, dynamic_relaxation_defaults)
+{
+  KeyValueParser parser;
+  EXPECT_EQ(parser.TimeIntegrationScheme(), "explicit");
+  EXPECT_EQ(parser.DynamicRelaxationDamping(), "rayleigh quotient");
+  EXPECT_EQ(parser.DynamicRelaxationMaxIterations(), 10000);
+}
+
+TEST(nimble_parser, dynamic_relaxation_keys)
+{
+  KeyValueParser parser;
+  parser.ParseKeyValue("time integration scheme", "dynamic relaxation");
+  parser.ParseKeyValue("dynamic relaxation damping", "kinetic energy");
+  parser.ParseKeyValue("dynamic relaxation maximum iterations", "250");
+  EXPECT_EQ(parser.TimeIntegrationScheme(), "dynamic relaxation");
+  EXPECT_EQ(parser.DynamicRelaxationDamping(), "kinetic energy");
+  EXPECT_EQ(parser.DynamicRelaxationMaxIterations(), 250);
+
+  parser.ParseKeyValue("dynamic relaxation damping", "viscous");
+  EXPECT_THROW(parser.DynamicRelaxationDamping(), std::invalid_argument);
+}
+
+}  // namespace nimble
@@ -0,0 +1,183 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <nimble_linear_solver.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace nimble {
+
+namespace {
+
+//
+// Nonlinear springs k x + c x^3 = load_factor * f, one per unknown, solved
+// over several load steps the same way as the quasistatic integrator: the
+// tangent k + 3 c x^2 is only evaluated when the refresh policy asks for it.
+//
+struct CubicSprings
+{
+  std::vector<double> k = {1.0, 2.0, 4.0, 8.0};
+  std::vector<double> c = {0.5, 1.0, 0.25, 2.0};
+  std::vector<double> f = {1.5, 3.0, 4.5, 10.0};
+
+  double
+  Residual(double load_factor, const std::vector<double>& x, std::vector<double>& r) const
+  {
+    for (unsigned int i = 0; i < x.size(); i++) { r[i] = k[i] * x[i] + c[i] * x[i] * x[i] * x[i] - load_factor * f[i]; }
+    return std::sqrt(InnerProduct(r, r));
+  }
+};
+
+// Returns the total number of nonlinear iterations over the load steps
+int
+SolveCubicSprings(const std::string& nonlinear_solver, TangentRefreshPolicy& tangent_refresh, std::vector<double>& x)
+{
+  const int    num_load_steps = 5;
+  const bool   use_bfgs       = (nonlinear_solver == "bfgs");
+  const int    n              = 4;
+  CubicSprings springs;
+
+  LimitedMemoryBFGS   bfgs;
+  std::vector<double> r(n), tangent(n), step(n), residual_change(n);
+  int                 total_iterations = 0;
+
+  x.assign(n, 0.0);
+  for (int load_step = 1; load_step <= num_load_steps; load_step++) {
+    double load_factor = static_cast<double>(load_step) / num_load_steps;
+    double residual    = springs.Residual(load_factor, x, r);
+    double tolerance   = 1.0e-10 * residual;
+    if (use_bfgs) bfgs.Clear();
+    while (residual > tolerance && total_iterations < 1000) {
+      double iteration_start_residual = residual;
+      if (tangent_refresh.NeedsAssembly()) {
+        for (int i = 0; i < n; i++) { tangent[i] = springs.k[i] + 3.0 * springs.c[i] * x[i] * x[i]; }
+        tangent_refresh.Assembled();
+        if (use_bfgs) bfgs.Clear();
+      }
+      step = r;
+      if (use_bfgs) bfgs.ApplyFirstLoop(step);
+      for (int i = 0; i < n; i++) { step[i] /= tangent[i]; }
+      if (use_bfgs) bfgs.ApplySecondLoop(step);
+      residual_change = r;
+      for (int i = 0; i < n; i++) { x[i] -= step[i]; }
+      residual = springs.Residual(load_factor, x, r);
+      if (use_bfgs) {
+        for (int i = 0; i < n; i++) {
+          step[i]            = -step[i];
+          residual_change[i] = r[i] - residual_change[i];
+        }
+        bfgs.AddPair(step, residual_change);
+      }
+      total_iterations += 1;
+      tangent_refresh.Iterated(iteration_start_residual, residual);
+    }
+  }
+  return total_iterations;
+}
+
+}  // namespace
+
+TEST(nimble_tangent_refresh, full_newton_assembles_every_iteration)
+{
+  TangentRefreshPolicy tangent_refresh(false, 10, 0.5);
+  for (int iteration = 0; iteration < 4; iteration++) {
+    ASSERT_TRUE(tangent_refresh.NeedsAssembly());
+    tangent_refresh.Assembled();
+    tangent_refresh.Iterated(1.0, 1.0e-3);
+  }
+  ASSERT_EQ(tangent_refresh.NumAssemblies(), 4);
+}
+
+TEST(nimble_tangent_refresh, refresh_interval_and_ratio)
+{
+  TangentRefreshPolicy tangent_refresh(true, 3, 0.5);
+  ASSERT_TRUE(tangent_refresh.NeedsAssembly());
+  tangent_refresh.Assembled();
+
+  // Fast contraction keeps the tangent until the refresh interval
+  double residual = 1.0;
+  for (int iteration = 0; iteration < 3; iteration++) {
+    ASSERT_FALSE(tangent_refresh.NeedsAssembly());
+    tangent_refresh.Iterated(residual, 0.1 * residual);
+    residual *= 0.1;
+  }
+  ASSERT_TRUE(tangent_refresh.NeedsAssembly());
+  tangent_refresh.Assembled();
+
+  // A slow iteration triggers the refresh at the next iteration only
+  tangent_refresh.Iterated(residual, 0.9 * residual);
+  ASSERT_TRUE(tangent_refresh.NeedsAssembly());
+  tangent_refresh.Assembled();
+  ASSERT_FALSE(tangent_refresh.NeedsAssembly());
+
+  tangent_refresh.Invalidate();
+  ASSERT_TRUE(tangent_refresh.NeedsAssembly());
+  ASSERT_EQ(tangent_refresh.NumAssemblies(), 3);
+}
+
+TEST(nimble_tangent_refresh, count_assemblies)
+{
+  std::vector<double> x_full_newton, x_modified_newton, x_bfgs;
+
+  TangentRefreshPolicy full_newton(false, 10, 0.5);
+  int full_newton_iterations = SolveCubicSprings("full newton", full_newton, x_full_newton);
+  ASSERT_EQ(full_newton.NumAssemblies(), full_newton_iterations);
+
+  TangentRefreshPolicy modified_newton(true, 10, 0.5);
+  int modified_newton_iterations = SolveCubicSprings("modified newton", modified_newton, x_modified_newton);
+  ASSERT_EQ(modified_newton.NumAssemblies(), 6);
+  ASSERT_GT(modified_newton_iterations, full_newton_iterations);
+
+  TangentRefreshPolicy bfgs(true, 10, 0.5);
+  int bfgs_iterations = SolveCubicSprings("bfgs", bfgs, x_bfgs);
+  ASSERT_EQ(bfgs.NumAssemblies(), 4);
+  ASSERT_LT(bfgs_iterations, modified_newton_iterations);
+
+  for (unsigned int i = 0; i < x_full_newton.size(); i++) {
+    ASSERT_NEAR(x_modified_newton[i], x_full_newton[i], 1.0e-8);
+    ASSERT_NEAR(x_bfgs[i], x_full_newton[i], 1.0e-8);
+  }
+}
+
+}  // namespace nimble
@@ -0,0 +1,149 @@
+//@HEADER
+// ************************************************************************
+//
+//                                NimbleSM
+//                             Copyright 2018
+//   National Technology & Engineering Solutions of Sandia, LLC (NTESS)
+//
+// Under the terms of Contract DE-NA0003525 with NTESS, the U.S. Government
+// retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY EXPRESS OR IMPLIED
+// WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+// NO EVENT SHALL NTESS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?  Contact David Littlewood (djlittl@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+#include <nimble_view.h>
+
+#include <cmath>
+#include <vector>
+
+namespace nimble {
+
+namespace {
+
+std::vector<double>
+TestValues(int size, double offset)
+{
+  std::vector<double> values(size);
+  for (int i = 0; i < size; i++) { values[i] = offset + 0.37 * i - 1.0e-3 * i * i; }
+  return values;
+}
+
+}  // namespace
+
+TEST(nimble_view, expression_matches_entrywise_update)
+{
+  // the larger size takes the threaded path when Kokkos is enabled
+  for (int num_nodes : {5, 5000}) {
+    const int           dim      = 3;
+    std::vector<double> v_data   = TestValues(num_nodes * dim, 0.5);
+    std::vector<double> a_data   = TestValues(num_nodes * dim, -2.0);
+    std::vector<double> expected = v_data;
+
+    Viewify<2> velocity(v_data.data(), {num_nodes, dim}, {dim, 1});
+    Viewify<2> acceleration(a_data.data(), {num_nodes, dim}, {dim, 1});
+
+    // dynamic relaxation update, the destination also appears on the right hand side
+    const double h = 0.01, damping = 3.0, scale = 1.0 / (2.0 + damping * h);
+    velocity = scale * ((2.0 - damping * h) * velocity + (2.0 * h) * acceleration);
+    for (std::size_t i = 0; i < expected.size(); i++) {
+      expected[i] = scale * ((2.0 - damping * h) * expected[i] + 2.0 * h * a_data[i]);
+    }
+    for (std::size_t i = 0; i < expected.size(); i++) { EXPECT_DOUBLE_EQ(v_data[i], expected[i]) << "entry " << i; }
+
+    velocity = (0.5 * h) * acceleration - velocity;
+    for (std::size_t i = 0; i < expected.size(); i++) { expected[i] = 0.5 * h * a_data[i] - expected[i]; }
+    for (std::size_t i = 0; i < expected.size(); i++) { EXPECT_DOUBLE_EQ(v_data[i], expected[i]) << "entry " << i; }
+  }
+}
+
+TEST(nimble_view, expression_assignment_keeps_binding)
+{
+  std::vector<double> u_data(6, 1.0), w_data(6, 2.0);
+  Viewify<1>          u(u_data.data(), 6);
+  Viewify<1>          w(w_data.data(), 6);
+
+  u = u + w;
+  EXPECT_EQ(u.data(), u_data.data());
+  for (double value : u_data) { EXPECT_DOUBLE_EQ(value, 3.0); }
+  for (double value : w_data) { EXPECT_DOUBLE_EQ(value, 2.0); }
+}
+
+TEST(nimble_view, fused_assign_matches_separate_statements)
+{
+  for (int num_nodes : {5, 5000}) {
+    const int           dim    = 3;
+    std::vector<double> v_data = TestValues(num_nodes * dim, 0.5);
+    std::vector<double> u_data = TestValues(num_nodes * dim, 4.0);
+    std::vector<double> a_data = TestValues(num_nodes * dim, -2.0);
+    std::vector<double> v_expected = v_data, u_expected = u_data;
+
+    Viewify<2> velocity(v_data.data(), {num_nodes, dim}, {dim, 1});
+    Viewify<2> displacement(u_data.data(), {num_nodes, dim}, {dim, 1});
+    Viewify<2> acceleration(a_data.data(), {num_nodes, dim}, {dim, 1});
+
+    // the displacement update reads the velocity assigned to the same entry
+    const double h = 0.01, damping = 3.0, scale = 1.0 / (2.0 + damping * h);
+    FusedAssign(
+        velocity,
+        scale * ((2.0 - damping * h) * velocity + (2.0 * h) * acceleration),
+        displacement,
+        displacement + h * velocity);
+    for (std::size_t i = 0; i < v_expected.size(); i++) {
+      v_expected[i] = scale * ((2.0 - damping * h) * v_expected[i] + 2.0 * h * a_data[i]);
+      u_expected[i] = u_expected[i] + h * v_expected[i];
+    }
+    for (std::size_t i = 0; i < v_expected.size(); i++) {
+      EXPECT_DOUBLE_EQ(v_data[i], v_expected[i]) << "entry " << i;
+      EXPECT_DOUBLE_EQ(u_data[i], u_expected[i]) << "entry " << i;
+    }
+  }
+}
+
+TEST(nimble_view, dot_of_expressions)
+{
+  for (int size : {7, 20000}) {
+    std::vector<double> x_data = TestValues(size, 0.25);
+    std::vector<double> y_data = TestValues(size, -1.5);
+    Viewify<1>          x(x_data.data(), size);
+    Viewify<1>          y(y_data.data(), size);
+
+    double xy(0.0), x_minus_y_squared(0.0);
+    for (int i = 0; i < size; i++) {
+      xy += x_data[i] * y_data[i];
+      x_minus_y_squared += (x_data[i] - y_data[i]) * (x_data[i] - y_data[i]);
+    }
+    EXPECT_NEAR(Dot(x, y), xy, 1.0e-12 * std::abs(xy));
+    EXPECT_NEAR(Dot(x - y, x - y), x_minus_y_squared, 1.0e-12 * x_minus_y_squared);
+  }
+}
+
+}  // namespace nimble